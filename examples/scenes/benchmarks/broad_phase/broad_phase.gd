@@ -0,0 +1,81 @@
+extends Node3D
+
+@export_range(1, 100000, 1, "or_greater")
+var body_count := 20000
+
+@export_range(1, 100000, 1, "or_greater")
+var ray_count := 10000
+
+@export_range(1.0, 10000.0, 1.0, "or_greater", "suffix:m")
+var extent := 500.0
+
+var bodies: Array[RID] = []
+var shape := RID()
+
+func _ready() -> void:
+	shape = PhysicsServer3D.box_shape_create()
+	PhysicsServer3D.shape_set_data(shape, Vector3.ONE * 0.5)
+
+	var space := get_world_3d().space
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	# Flush after every body, to mimic bodies being streamed in over time
+	for i in range(body_count):
+		var body := PhysicsServer3D.body_create()
+		PhysicsServer3D.body_set_mode(body, PhysicsServer3D.BODY_MODE_STATIC)
+		PhysicsServer3D.body_add_shape(body, shape)
+		PhysicsServer3D.body_set_state(body, PhysicsServer3D.BODY_STATE_TRANSFORM, Transform3D(
+			Basis.IDENTITY,
+			Vector3(
+				rng.randf_range(-extent, extent),
+				rng.randf_range(-extent, extent),
+				rng.randf_range(-extent, extent)
+			)
+		))
+		PhysicsServer3D.body_set_space(body, space)
+		PhysicsServer3D.call(&"space_flush_pending_bodies", space)
+		bodies.append(body)
+
+	var before := _measure_rays()
+
+	var start := Time.get_ticks_usec()
+	PhysicsServer3D.call(&"space_optimize_broad_phase", space)
+	var optimize_time := Time.get_ticks_usec() - start
+
+	var after := _measure_rays()
+
+	print("Bodies: %d, rays: %d" % [body_count, ray_count])
+	print("Before optimization: %.2f ms" % [before / 1000.0])
+	print("Optimization: %.2f ms" % [optimize_time / 1000.0])
+	print("After optimization: %.2f ms" % [after / 1000.0])
+
+func _exit_tree() -> void:
+	for body in bodies:
+		PhysicsServer3D.free_rid(body)
+
+	PhysicsServer3D.free_rid(shape)
+
+func _measure_rays() -> int:
+	var space_state := get_world_3d().direct_space_state
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 1
+
+	var query := PhysicsRayQueryParameters3D.new()
+
+	var start := Time.get_ticks_usec()
+
+	for i in range(ray_count):
+		query.from = Vector3(
+			rng.randf_range(-extent, extent),
+			rng.randf_range(-extent, extent),
+			rng.randf_range(-extent, extent)
+		)
+		query.to = query.from + Vector3(
+			rng.randf_range(-1.0, 1.0),
+			rng.randf_range(-1.0, 1.0),
+			rng.randf_range(-1.0, 1.0)
+		).normalized() * extent * 0.1
+		space_state.intersect_ray(query)
+
+	return Time.get_ticks_usec() - start
@@ -0,0 +1,106 @@
+extends Node3D
+
+@export_range(1, 100000, 1, "or_greater")
+var body_count := 10000
+
+@export_range(1, 1000000, 1, "or_greater")
+var ray_count := 100000
+
+@export_range(1.0, 10000.0, 1.0, "or_greater", "suffix:m")
+var extent := 250.0
+
+var bodies: Array[RID] = []
+var shape := RID()
+
+func _ready() -> void:
+	shape = PhysicsServer3D.box_shape_create()
+	PhysicsServer3D.shape_set_data(shape, Vector3.ONE * 0.5)
+
+	var space := get_world_3d().space
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	for i in range(body_count):
+		var body := PhysicsServer3D.body_create()
+		PhysicsServer3D.body_set_mode(body, PhysicsServer3D.BODY_MODE_STATIC)
+		PhysicsServer3D.body_add_shape(body, shape)
+		PhysicsServer3D.body_set_state(body, PhysicsServer3D.BODY_STATE_TRANSFORM, Transform3D(
+			Basis.IDENTITY,
+			Vector3(
+				rng.randf_range(-extent, extent),
+				rng.randf_range(-extent, extent),
+				rng.randf_range(-extent, extent)
+			)
+		))
+		PhysicsServer3D.body_set_space(body, space)
+		bodies.append(body)
+
+	PhysicsServer3D.call(&"space_optimize_broad_phase", space)
+
+	var from_to := _generate_rays()
+
+	var single_time := _measure_single(from_to)
+	var batched_time := _measure_batched(from_to)
+
+	print("Bodies: %d, rays: %d" % [body_count, ray_count])
+	print("intersect_ray: %.2f ms (%.1f rays/ms)" % [
+		single_time / 1000.0,
+		ray_count / (single_time / 1000.0)
+	])
+	print("intersect_rays: %.2f ms (%.1f rays/ms)" % [
+		batched_time / 1000.0,
+		ray_count / (batched_time / 1000.0)
+	])
+
+func _exit_tree() -> void:
+	for body in bodies:
+		PhysicsServer3D.free_rid(body)
+
+	PhysicsServer3D.free_rid(shape)
+
+func _generate_rays() -> PackedVector3Array:
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 1
+
+	var from_to := PackedVector3Array()
+	from_to.resize(ray_count * 2)
+
+	for i in range(ray_count):
+		var from := Vector3(
+			rng.randf_range(-extent, extent),
+			rng.randf_range(-extent, extent),
+			rng.randf_range(-extent, extent)
+		)
+
+		var direction := Vector3(
+			rng.randf_range(-1.0, 1.0),
+			rng.randf_range(-1.0, 1.0),
+			rng.randf_range(-1.0, 1.0)
+		).normalized()
+
+		from_to[i * 2 + 0] = from
+		from_to[i * 2 + 1] = from + direction * extent * 0.1
+
+	return from_to
+
+func _measure_single(from_to: PackedVector3Array) -> int:
+	var space_state := get_world_3d().direct_space_state
+	var query := PhysicsRayQueryParameters3D.new()
+
+	var start := Time.get_ticks_usec()
+
+	for i in range(ray_count):
+		query.from = from_to[i * 2 + 0]
+		query.to = from_to[i * 2 + 1]
+		space_state.intersect_ray(query)
+
+	return Time.get_ticks_usec() - start
+
+func _measure_batched(from_to: PackedVector3Array) -> int:
+	var space_state := get_world_3d().direct_space_state
+
+	var start := Time.get_ticks_usec()
+
+	space_state.call(&"intersect_rays", from_to, 0xFFFFFFFF, true, false, false, true)
+
+	return Time.get_ticks_usec() - start
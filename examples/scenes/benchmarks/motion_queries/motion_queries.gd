@@ -0,0 +1,115 @@
+extends Node3D
+
+@export_range(1, 100000, 1, "or_greater")
+var body_count := 5000
+
+@export_range(1, 100000, 1, "or_greater")
+var query_count := 10000
+
+@export_range(1.0, 10000.0, 1.0, "or_greater", "suffix:m")
+var extent := 100.0
+
+@export_range(0.1, 100.0, 0.1, "or_greater", "suffix:m")
+var motion_length := 10.0
+
+var bodies: Array[RID] = []
+var box_shape := RID()
+var capsule_shape := RID()
+var character := RID()
+
+func _ready() -> void:
+	box_shape = PhysicsServer3D.box_shape_create()
+	PhysicsServer3D.shape_set_data(box_shape, Vector3.ONE * 0.5)
+
+	capsule_shape = PhysicsServer3D.capsule_shape_create()
+	PhysicsServer3D.shape_set_data(capsule_shape, {"radius": 0.4, "height": 1.8})
+
+	var space := get_world_3d().space
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	for i in range(body_count):
+		var body := PhysicsServer3D.body_create()
+		PhysicsServer3D.body_set_mode(body, PhysicsServer3D.BODY_MODE_STATIC)
+		PhysicsServer3D.body_add_shape(body, box_shape)
+		PhysicsServer3D.body_set_state(body, PhysicsServer3D.BODY_STATE_TRANSFORM, Transform3D(
+			Basis.IDENTITY,
+			_random_position(rng)
+		))
+		PhysicsServer3D.body_set_space(body, space)
+		bodies.append(body)
+
+	character = PhysicsServer3D.body_create()
+	PhysicsServer3D.body_set_mode(character, PhysicsServer3D.BODY_MODE_KINEMATIC)
+	PhysicsServer3D.body_add_shape(character, capsule_shape)
+	PhysicsServer3D.body_set_space(character, space)
+
+	PhysicsServer3D.call(&"space_optimize_broad_phase", space)
+
+	var cast_motion_time := _measure_cast_motion()
+	var test_motion_time := _measure_body_test_motion()
+
+	print("Bodies: %d, queries: %d" % [body_count, query_count])
+	print("cast_motion: %.2f ms (%.1f queries/ms)" % [
+		cast_motion_time / 1000.0,
+		query_count / (cast_motion_time / 1000.0)
+	])
+	print("body_test_motion: %.2f ms (%.1f queries/ms)" % [
+		test_motion_time / 1000.0,
+		query_count / (test_motion_time / 1000.0)
+	])
+
+func _exit_tree() -> void:
+	for body in bodies:
+		PhysicsServer3D.free_rid(body)
+
+	PhysicsServer3D.free_rid(character)
+	PhysicsServer3D.free_rid(capsule_shape)
+	PhysicsServer3D.free_rid(box_shape)
+
+func _random_position(rng: RandomNumberGenerator) -> Vector3:
+	return Vector3(
+		rng.randf_range(-extent, extent),
+		rng.randf_range(-extent, extent),
+		rng.randf_range(-extent, extent)
+	)
+
+func _random_motion(rng: RandomNumberGenerator) -> Vector3:
+	return Vector3(
+		rng.randf_range(-1.0, 1.0),
+		rng.randf_range(-1.0, 1.0),
+		rng.randf_range(-1.0, 1.0)
+	).normalized() * motion_length
+
+func _measure_cast_motion() -> int:
+	var space_state := get_world_3d().direct_space_state
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 1
+
+	var query := PhysicsShapeQueryParameters3D.new()
+	query.shape_rid = capsule_shape
+
+	var start := Time.get_ticks_usec()
+
+	for i in range(query_count):
+		query.transform = Transform3D(Basis.IDENTITY, _random_position(rng))
+		query.motion = _random_motion(rng)
+		space_state.cast_motion(query)
+
+	return Time.get_ticks_usec() - start
+
+func _measure_body_test_motion() -> int:
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 1
+
+	var parameters := PhysicsTestMotionParameters3D.new()
+	var result := PhysicsTestMotionResult3D.new()
+
+	var start := Time.get_ticks_usec()
+
+	for i in range(query_count):
+		parameters.from = Transform3D(Basis.IDENTITY, _random_position(rng))
+		parameters.motion = _random_motion(rng)
+		PhysicsServer3D.body_test_motion(character, parameters, result)
+
+	return Time.get_ticks_usec() - start
@@ -0,0 +1,86 @@
+extends Node3D
+
+@export_range(1, 1000, 1, "or_greater")
+var ragdoll_count := 40
+
+@export_range(2, 200, 1, "or_greater")
+var parts_per_ragdoll := 50
+
+@export_range(1, 10000, 1, "or_greater")
+var frame_count := 300
+
+var bodies: Array[RID] = []
+var floor_body := RID()
+var part_shape := RID()
+var floor_shape := RID()
+
+var frames_measured := 0
+var total_time := 0.0
+
+func _ready() -> void:
+	part_shape = PhysicsServer3D.capsule_shape_create()
+	PhysicsServer3D.shape_set_data(part_shape, {radius = 0.1, height = 0.4})
+
+	floor_shape = PhysicsServer3D.world_boundary_shape_create()
+	PhysicsServer3D.shape_set_data(floor_shape, Plane.PLANE_XZ)
+
+	var space := get_world_3d().space
+
+	floor_body = PhysicsServer3D.body_create()
+	PhysicsServer3D.body_set_mode(floor_body, PhysicsServer3D.BODY_MODE_STATIC)
+	PhysicsServer3D.body_add_shape(floor_body, floor_shape)
+	PhysicsServer3D.body_set_space(floor_body, space)
+
+	var rng := RandomNumberGenerator.new()
+	rng.seed = 0
+
+	for i in range(ragdoll_count):
+		var parts: Array[RID] = []
+
+		var origin := Vector3(
+			rng.randf_range(-2.0, 2.0),
+			1.0 + i * 1.5,
+			rng.randf_range(-2.0, 2.0)
+		)
+
+		for j in range(parts_per_ragdoll):
+			var part := PhysicsServer3D.body_create()
+			PhysicsServer3D.body_set_mode(part, PhysicsServer3D.BODY_MODE_RIGID)
+			PhysicsServer3D.body_add_shape(part, part_shape)
+			PhysicsServer3D.body_set_state(part, PhysicsServer3D.BODY_STATE_TRANSFORM, Transform3D(
+				Basis.IDENTITY,
+				origin + Vector3(
+					rng.randf_range(-0.5, 0.5),
+					rng.randf_range(-0.5, 0.5),
+					rng.randf_range(-0.5, 0.5)
+				)
+			))
+			PhysicsServer3D.body_set_space(part, space)
+			parts.append(part)
+
+		# Like the parts of a skeleton, every part ignores every other part of the same ragdoll
+		for part in parts:
+			for other_part in parts:
+				if part != other_part:
+					PhysicsServer3D.body_add_collision_exception(part, other_part)
+
+		bodies.append_array(parts)
+
+func _physics_process(_delta: float) -> void:
+	if frames_measured == frame_count:
+		return
+
+	total_time += Performance.get_monitor(Performance.TIME_PHYSICS_PROCESS)
+	frames_measured += 1
+
+	if frames_measured == frame_count:
+		print("Ragdolls: %d, parts per ragdoll: %d" % [ragdoll_count, parts_per_ragdoll])
+		print("Average physics frame: %.3f ms" % [total_time / frame_count * 1000.0])
+
+func _exit_tree() -> void:
+	for body in bodies:
+		PhysicsServer3D.free_rid(body)
+
+	PhysicsServer3D.free_rid(floor_body)
+	PhysicsServer3D.free_rid(part_shape)
+	PhysicsServer3D.free_rid(floor_shape)
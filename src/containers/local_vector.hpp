@@ -116,6 +116,10 @@ public:
 		impl.insert(iter, std::move(p_val));
 	}
 
+	_FORCE_INLINE_ bool ordered_has(const TElement& p_value) const {
+		return std::binary_search(begin(), end(), p_value);
+	}
+
 	_FORCE_INLINE_ int32_t find(const TElement& p_value, int32_t p_from = 0) const {
 		if (p_from < size()) {
 			auto found = std::find(begin() + p_from, end(), p_value);
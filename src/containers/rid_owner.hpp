@@ -22,9 +22,17 @@ public:
 	}
 
 	_FORCE_INLINE_ RID make_rid(TResource* p_ptr) {
-		const int64_t id = UtilityFunctions::rid_allocate_id();
-		ptrs_by_id[id] = p_ptr;
-		return UtilityFunctions::rid_from_int64(id);
+		const RID rid = allocate_rid();
+		initialize_rid(rid, p_ptr);
+		return rid;
+	}
+
+	_FORCE_INLINE_ RID allocate_rid() {
+		return UtilityFunctions::rid_from_int64(UtilityFunctions::rid_allocate_id());
+	}
+
+	_FORCE_INLINE_ void initialize_rid(const RID& p_rid, TResource* p_ptr) {
+		ptrs_by_id[p_rid.get_id()] = p_ptr;
 	}
 
 	_FORCE_INLINE_ TResource* get_or_null(const RID& p_rid) const {
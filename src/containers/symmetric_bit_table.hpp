@@ -12,6 +12,8 @@ public:
 		memset(bits.ptr(), 0, (size_t)bits.size());
 	}
 
+	int32_t get_size() const { return size; }
+
 	void set(int32_t p_x, int32_t p_y) {
 		ERR_FAIL_INDEX(p_x, size);
 		ERR_FAIL_INDEX(p_y, size);
@@ -37,3 +37,66 @@ _FORCE_INLINE_ double estimate_physics_step() {
 
 	return step_scaled;
 }
+
+// Splits the items into as many chunks as the job system can run concurrently, but never into
+// chunks smaller than `p_min_items_per_chunk`, since below some size the overhead of scheduling a
+// job outweighs the work done in it. Where that size lies depends on how expensive each item is.
+_FORCE_INLINE_ int32_t calculate_job_chunk_count(
+	const JPH::JobSystem& p_job_system,
+	int32_t p_item_count,
+	int32_t p_min_items_per_chunk
+) {
+	const int32_t max_chunks = MAX(p_job_system.GetMaxConcurrency(), 1);
+	const int32_t min_chunk_size = MAX(p_min_items_per_chunk, 1);
+	const int32_t needed_chunks = (p_item_count + min_chunk_size - 1) / min_chunk_size;
+	return CLAMP(needed_chunks, 1, max_chunks);
+}
+
+template<typename TCallback>
+void run_in_job_chunks(
+	JPH::JobSystem& p_job_system,
+	const char* p_job_name,
+	int32_t p_item_count,
+	int32_t p_chunk_count,
+	TCallback&& p_callback
+) {
+	if (p_chunk_count <= 1) {
+		p_callback(0, 0, p_item_count);
+		return;
+	}
+
+	const int32_t chunk_size = (p_item_count + p_chunk_count - 1) / p_chunk_count;
+
+	JPH::JobSystem::Barrier* barrier = p_job_system.CreateBarrier();
+
+	// The job system only has a handful of barriers to go around, which can run out when several
+	// threads are doing this at once, in which case we just do the work on this thread instead
+	if (barrier == nullptr) {
+		for (int32_t chunk = 0; chunk < p_chunk_count; ++chunk) {
+			const int32_t start = chunk * chunk_size;
+			const int32_t end = MIN(start + chunk_size, p_item_count);
+
+			p_callback(chunk, start, end);
+		}
+
+		return;
+	}
+
+	for (int32_t chunk = 0; chunk < p_chunk_count; ++chunk) {
+		const int32_t start = chunk * chunk_size;
+		const int32_t end = MIN(start + chunk_size, p_item_count);
+
+		const JPH::JobHandle job = p_job_system.CreateJob(
+			p_job_name,
+			JPH::Color::sGreen,
+			[&p_callback, chunk, start, end]() {
+				p_callback(chunk, start, end);
+			}
+		);
+
+		barrier->AddJob(job);
+	}
+
+	p_job_system.WaitForJobs(barrier);
+	p_job_system.DestroyBarrier(barrier);
+}
@@ -50,6 +50,8 @@ void JoltAreaImpl3D::set_transform(const Transform3D& p_transform) {
 			JPH::EActivation::DontActivate
 		);
 	}
+
+	_update_gravity_point();
 }
 
 Variant JoltAreaImpl3D::get_param(PhysicsServer3D::AreaParameter p_param) const {
@@ -200,6 +202,32 @@ void JoltAreaImpl3D::set_area_monitor_callback(const Callable& p_callback) {
 	_area_monitoring_changed();
 }
 
+void JoltAreaImpl3D::set_batching_events(bool p_enabled) {
+	if (batching_events_requested == p_enabled) {
+		return;
+	}
+
+	batching_events_requested = p_enabled;
+
+	// Any events that are already pending are meant for whoever is currently receiving them, so we
+	// hold off on actually switching until the next time we flush them, in `call_queries`
+	_enqueue_call_queries();
+}
+
+Dictionary JoltAreaImpl3D::take_pending_events() {
+	Dictionary events;
+	events["status"] = pending_events.statuses;
+	events["rid"] = pending_events.rids;
+	events["collider_id"] = pending_events.instance_ids;
+	events["collider_shape"] = pending_events.other_shapes;
+	events["local_shape"] = pending_events.self_shapes;
+	events["area"] = pending_events.areas;
+
+	pending_events = PendingEvents();
+
+	return events;
+}
+
 void JoltAreaImpl3D::set_monitorable(bool p_monitorable) {
 	if (p_monitorable == monitorable) {
 		return;
@@ -293,8 +321,7 @@ Vector3 JoltAreaImpl3D::compute_gravity(const Vector3& p_position) const {
 		return gravity_vector * gravity;
 	}
 
-	const Vector3 point = get_transform_scaled().xform(gravity_vector);
-	const Vector3 to_point = point - p_position;
+	const Vector3 to_point = gravity_point - p_position;
 	const real_t to_point_dist_sq = MAX(to_point.length_squared(), (real_t)CMP_EPSILON);
 	const Vector3 to_point_dir = to_point / Math::sqrt(to_point_dist_sq);
 
@@ -375,8 +402,11 @@ bool JoltAreaImpl3D::shape_exited(
 }
 
 void JoltAreaImpl3D::call_queries([[maybe_unused]] JPH::Body& p_jolt_body) {
-	_flush_events(bodies_by_id, body_monitor_callback);
-	_flush_events(areas_by_id, area_monitor_callback);
+	if (batching_events != batching_events_requested) {
+		_switch_batching_events();
+	}
+
+	_flush_events();
 }
 
 JPH::BroadPhaseLayer JoltAreaImpl3D::_get_broad_phase_layer() const {
@@ -418,6 +448,10 @@ void JoltAreaImpl3D::_add_to_space() {
 	JPH::BodyInterface& body_iface = space->get_body_iface();
 	JPH::Body* body = body_iface.CreateBody(*jolt_settings);
 
+	if (body == nullptr) {
+		space->release_object_layer(jolt_settings->mObjectLayer);
+	}
+
 	ERR_FAIL_NULL_MSG(
 		body,
 		vformat(
@@ -431,7 +465,7 @@ void JoltAreaImpl3D::_add_to_space() {
 
 	jolt_id = body->GetID();
 
-	body_iface.AddBody(jolt_id, JPH::EActivation::Activate);
+	space->add_body(jolt_id);
 }
 
 void JoltAreaImpl3D::_add_shape_pair(
@@ -453,6 +487,8 @@ void JoltAreaImpl3D::_add_shape_pair(
 	shape_indices.self = find_shape_index(p_self_shape_id);
 
 	p_overlap.pending_added.push_back(shape_indices);
+
+	_enqueue_call_queries();
 }
 
 bool JoltAreaImpl3D::_remove_shape_pair(
@@ -469,14 +505,51 @@ bool JoltAreaImpl3D::_remove_shape_pair(
 	p_overlap.pending_removed.push_back(shape_pair->second);
 	p_overlap.shape_pairs.remove(shape_pair);
 
+	_enqueue_call_queries();
+
 	return true;
 }
 
-void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_callback) {
+void JoltAreaImpl3D::_flush_events() {
+	_flush_events(bodies_by_id, body_monitor_callback, false);
+	_flush_events(areas_by_id, area_monitor_callback, true);
+
+	if (batched_event_callback.is_valid() && !pending_events.statuses.is_empty()) {
+		batched_event_callback.call(take_pending_events());
+	}
+}
+
+void JoltAreaImpl3D::_flush_events(
+	OverlapsById& p_objects,
+	const Callable& p_callback,
+	bool p_areas
+) {
 	p_objects.erase_if([&](auto& p_pair) {
 		auto& [id, overlap] = p_pair;
 
-		if (p_callback.is_valid()) {
+		if (batching_events) {
+			for (auto& shape_indices : overlap.pending_removed) {
+				_queue_event(
+					PhysicsServer3D::AREA_BODY_REMOVED,
+					overlap.rid,
+					overlap.instance_id,
+					shape_indices.other,
+					shape_indices.self,
+					p_areas
+				);
+			}
+
+			for (auto& shape_indices : overlap.pending_added) {
+				_queue_event(
+					PhysicsServer3D::AREA_BODY_ADDED,
+					overlap.rid,
+					overlap.instance_id,
+					shape_indices.other,
+					shape_indices.self,
+					p_areas
+				);
+			}
+		} else if (p_callback.is_valid()) {
 			for (auto& shape_indices : overlap.pending_removed) {
 				_report_event(
 					p_callback,
@@ -507,6 +580,24 @@ void JoltAreaImpl3D::_flush_events(OverlapsById& p_objects, const Callable& p_ca
 	});
 }
 
+void JoltAreaImpl3D::_switch_batching_events() {
+	// Whoever has been receiving our events so far gets whatever is still pending, followed by an
+	// exit for everything we're currently overlapping, so that they're not left holding on to any
+	// stale overlaps. Whoever receives them from now on then gets an entry for those same overlaps,
+	// same as when assigning a monitor callback.
+	_flush_events();
+
+	_force_bodies_exited(false);
+	_force_areas_exited(false);
+
+	_flush_events();
+
+	batching_events = batching_events_requested;
+
+	_force_bodies_entered();
+	_force_areas_entered();
+}
+
 void JoltAreaImpl3D::_report_event(
 	const Callable& p_callback,
 	PhysicsServer3D::AreaBodyStatus p_status,
@@ -532,6 +623,22 @@ void JoltAreaImpl3D::_report_event(
 	p_callback.callv(arguments);
 }
 
+void JoltAreaImpl3D::_queue_event(
+	PhysicsServer3D::AreaBodyStatus p_status,
+	const RID& p_other_rid,
+	ObjectID p_other_instance_id,
+	int32_t p_other_shape_index,
+	int32_t p_self_shape_index,
+	bool p_other_is_area
+) {
+	pending_events.statuses.push_back(p_status);
+	pending_events.rids.push_back((int64_t)p_other_rid.get_id());
+	pending_events.instance_ids.push_back((int64_t)(uint64_t)p_other_instance_id);
+	pending_events.other_shapes.push_back(p_other_shape_index);
+	pending_events.self_shapes.push_back(p_self_shape_index);
+	pending_events.areas.push_back(p_other_is_area ? 1 : 0);
+}
+
 void JoltAreaImpl3D::_notify_body_entered(const JPH::BodyID& p_body_id) {
 	const JoltReadableBody3D jolt_body = space->read_body(p_body_id);
 
@@ -556,6 +663,8 @@ void JoltAreaImpl3D::_force_bodies_entered() {
 			body.pending_added.push_back(index_pair);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_bodies_exited(bool p_remove) {
@@ -569,6 +678,8 @@ void JoltAreaImpl3D::_force_bodies_exited(bool p_remove) {
 			_notify_body_exited(id);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_areas_entered() {
@@ -577,6 +688,8 @@ void JoltAreaImpl3D::_force_areas_entered() {
 			area.pending_added.push_back(index_pair);
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_force_areas_exited(bool p_remove) {
@@ -589,6 +702,8 @@ void JoltAreaImpl3D::_force_areas_exited(bool p_remove) {
 			area.shape_pairs.clear();
 		}
 	}
+
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_update_group_filter() {
@@ -608,6 +723,13 @@ void JoltAreaImpl3D::_update_default_gravity() {
 	}
 }
 
+void JoltAreaImpl3D::_update_gravity_point() {
+	// Point gravity is evaluated for every body within the area on every step, often concurrently,
+	// so rather than reading the area's transform each time we resolve the point up front, which
+	// works out since areas only ever move through `set_transform`.
+	gravity_point = get_transform_scaled().xform(gravity_vector);
+}
+
 void JoltAreaImpl3D::_space_changing() {
 	JoltShapedObjectImpl3D::_space_changing();
 
@@ -626,6 +748,10 @@ void JoltAreaImpl3D::_space_changed() {
 
 	_update_group_filter();
 	_update_default_gravity();
+	_update_gravity_point();
+
+	// Any events that were left pending when leaving the previous space need to be reported
+	_enqueue_call_queries();
 }
 
 void JoltAreaImpl3D::_body_monitoring_changed() {
@@ -650,4 +776,5 @@ void JoltAreaImpl3D::_monitorable_changed() {
 
 void JoltAreaImpl3D::_gravity_changed() {
 	_update_default_gravity();
+	_update_gravity_point();
 }
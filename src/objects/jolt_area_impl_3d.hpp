@@ -52,6 +52,20 @@ class JoltAreaImpl3D final : public JoltShapedObjectImpl3D {
 
 	using OverlapsById = HashMap<JPH::BodyID, Overlap, BodyIDHasher>;
 
+	struct PendingEvents {
+		PackedInt32Array statuses;
+
+		PackedInt64Array rids;
+
+		PackedInt64Array instance_ids;
+
+		PackedInt32Array other_shapes;
+
+		PackedInt32Array self_shapes;
+
+		PackedByteArray areas;
+	};
+
 public:
 	using OverrideMode = PhysicsServer3D::AreaSpaceOverrideMode;
 
@@ -75,6 +89,16 @@ public:
 
 	void set_area_monitor_callback(const Callable& p_callback);
 
+	bool is_batching_events() const { return batching_events_requested; }
+
+	void set_batching_events(bool p_enabled);
+
+	void set_batched_event_callback(const Callable& p_callback) {
+		batched_event_callback = p_callback;
+	}
+
+	Dictionary take_pending_events();
+
 	bool is_monitorable() const { return monitorable; }
 
 	void set_monitorable(bool p_monitorable);
@@ -195,7 +219,11 @@ private:
 		const JPH::SubShapeID& p_self_shape_id
 	);
 
-	void _flush_events(OverlapsById& p_objects, const Callable& p_callback);
+	void _flush_events();
+
+	void _flush_events(OverlapsById& p_objects, const Callable& p_callback, bool p_areas);
+
+	void _switch_batching_events();
 
 	void _report_event(
 		const Callable& p_callback,
@@ -206,6 +234,15 @@ private:
 		int32_t p_self_shape_index
 	) const;
 
+	void _queue_event(
+		PhysicsServer3D::AreaBodyStatus p_status,
+		const RID& p_other_rid,
+		ObjectID p_other_instance_id,
+		int32_t p_other_shape_index,
+		int32_t p_self_shape_index,
+		bool p_other_is_area
+	);
+
 	void _notify_body_entered(const JPH::BodyID& p_body_id);
 
 	void _notify_body_exited(const JPH::BodyID& p_body_id);
@@ -222,6 +259,8 @@ private:
 
 	void _update_default_gravity();
 
+	void _update_gravity_point();
+
 	void _space_changing() override;
 
 	void _space_changed() override;
@@ -240,10 +279,16 @@ private:
 
 	Vector3 gravity_vector = {0, -1, 0};
 
+	Vector3 gravity_point = {0, -1, 0};
+
 	Callable body_monitor_callback;
 
 	Callable area_monitor_callback;
 
+	Callable batched_event_callback;
+
+	PendingEvents pending_events;
+
 	float priority = 0.0f;
 
 	float gravity = 9.8f;
@@ -263,4 +308,8 @@ private:
 	bool monitorable = false;
 
 	bool point_gravity = false;
+
+	bool batching_events = false;
+
+	bool batching_events_requested = false;
 };
@@ -39,6 +39,34 @@ bool integrate(TValue& p_value, PhysicsServer3D::AreaSpaceOverrideMode p_mode, T
 	}
 }
 
+template<typename TPackedArray, typename TElement, typename TConverter>
+TPackedArray to_packed(
+	const LocalVector<TElement>& p_values,
+	const JoltContactBuffer3D::Range& p_range,
+	TConverter&& p_convert
+) {
+	TPackedArray packed;
+	packed.resize(p_range.count);
+
+	auto* dst = packed.ptrw();
+
+	for (int32_t i = 0; i < p_range.count; ++i) {
+		dst[i] = p_convert(p_values[p_range.offset + i]);
+	}
+
+	return packed;
+}
+
+template<typename TPackedArray, typename TElement>
+TPackedArray to_packed(
+	const LocalVector<TElement>& p_values,
+	const JoltContactBuffer3D::Range& p_range
+) {
+	return to_packed<TPackedArray>(p_values, p_range, [](const TElement& p_value) {
+		return p_value;
+	});
+}
+
 } // namespace
 
 JoltBodyImpl3D::JoltBodyImpl3D()
@@ -74,6 +102,7 @@ void JoltBodyImpl3D::set_transform(const Transform3D& p_transform) {
 		jolt_settings->mRotation = to_jolt(new_transform.basis);
 	} else if (is_kinematic()) {
 		kinematic_transform = p_transform;
+		_enqueue_pre_step();
 	} else {
 		space->get_body_iface().SetPositionAndRotation(
 			jolt_id,
@@ -248,10 +277,7 @@ bool JoltBodyImpl3D::is_sleeping() const {
 		return false;
 	}
 
-	const JoltReadableBody3D body = space->read_body(jolt_id);
-	ERR_FAIL_COND_D(body.is_invalid());
-
-	return !body->IsActive();
+	return space->is_body_sleeping(jolt_id);
 }
 
 void JoltBodyImpl3D::set_is_sleeping(bool p_enabled) {
@@ -261,13 +287,7 @@ void JoltBodyImpl3D::set_is_sleeping(bool p_enabled) {
 		return;
 	}
 
-	JPH::BodyInterface& body_iface = space->get_body_iface();
-
-	if (p_enabled) {
-		body_iface.DeactivateBody(jolt_id);
-	} else {
-		body_iface.ActivateBody(jolt_id);
-	}
+	space->set_body_sleeping(jolt_id, p_enabled);
 }
 
 bool JoltBodyImpl3D::can_sleep() const {
@@ -468,7 +488,7 @@ void JoltBodyImpl3D::set_center_of_mass_custom(const Vector3& p_center_of_mass)
 }
 
 void JoltBodyImpl3D::set_max_contacts_reported(int32_t p_count) {
-	if (contacts.size() == p_count) {
+	if (max_contacts_reported == p_count) {
 		return;
 	}
 
@@ -476,8 +496,7 @@ void JoltBodyImpl3D::set_max_contacts_reported(int32_t p_count) {
 		_contact_reporting_changed();
 	};
 
-	contacts.resize(p_count);
-	contact_count = MIN(contact_count, p_count);
+	max_contacts_reported = p_count;
 
 	const bool use_manifold_reduction = !reports_contacts();
 
@@ -495,54 +514,49 @@ bool JoltBodyImpl3D::reports_all_kinematic_contacts() const {
 	return reports_contacts() && JoltProjectSettings::report_all_kinematic_contacts();
 }
 
-void JoltBodyImpl3D::add_contact(
-	const JoltBodyImpl3D* p_collider,
-	float p_depth,
-	int32_t p_shape_index,
-	int32_t p_collider_shape_index,
-	const Vector3& p_normal,
-	const Vector3& p_position,
-	const Vector3& p_collider_position,
-	const Vector3& p_velocity,
-	const Vector3& p_collider_velocity,
-	const Vector3& p_impulse
-) {
-	const int32_t max_contacts = get_max_contacts_reported();
-
-	if (max_contacts == 0) {
-		return;
+JoltContactBuffer3D::Range JoltBodyImpl3D::get_contacts() const {
+	if (space == nullptr || max_contacts_reported == 0) {
+		return {};
 	}
 
-	Contact* contact = nullptr;
+	return space->get_reported_contacts().find(jolt_id, max_contacts_reported);
+}
 
-	if (contact_count < max_contacts) {
-		contact = &contacts[contact_count++];
-	} else {
-		auto shallowest = std::min_element(
-			contacts.begin(),
-			contacts.end(),
-			[](const Contact& p_lhs, const Contact& p_rhs) {
-				return p_lhs.depth < p_rhs.depth;
-			}
-		);
+Dictionary JoltBodyImpl3D::get_contacts_packed() const {
+	const JoltContactBuffer3D::Range range = get_contacts();
 
-		if (shallowest->depth < p_depth) {
-			contact = &*shallowest;
-		}
-	}
+	auto rid_to_int = [](const RID& p_rid) {
+		return (int64_t)p_rid.get_id();
+	};
 
-	if (contact != nullptr) {
-		contact->shape_index = p_shape_index;
-		contact->collider_shape_index = p_collider_shape_index;
-		contact->collider_id = p_collider->get_instance_id();
-		contact->collider_rid = p_collider->get_rid();
-		contact->normal = p_normal;
-		contact->position = p_position;
-		contact->collider_position = p_collider_position;
-		contact->velocity = p_velocity;
-		contact->collider_velocity = p_collider_velocity;
-		contact->impulse = p_impulse;
-	}
+	auto id_to_int = [](ObjectID p_id) {
+		return (int64_t)(uint64_t)p_id;
+	};
+
+	static const JoltContactBuffer3D no_contacts;
+	const JoltContactBuffer3D& contacts = range.buffer != nullptr ? *range.buffer : no_contacts;
+
+	Dictionary result;
+	result["local_position"] = to_packed<PackedVector3Array>(contacts.positions, range);
+	result["local_normal"] = to_packed<PackedVector3Array>(contacts.normals, range);
+	result["impulse"] = to_packed<PackedVector3Array>(contacts.impulses, range);
+	result["local_shape"] = to_packed<PackedInt32Array>(contacts.shape_indices, range);
+	result["collider"] = to_packed<PackedInt64Array>(contacts.collider_rids, range, rid_to_int);
+	result["collider_position"] = to_packed<PackedVector3Array>(contacts.collider_positions, range);
+	result["collider_id"] = to_packed<PackedInt64Array>(contacts.collider_ids, range, id_to_int);
+	result["collider_shape"] = to_packed<PackedInt32Array>(contacts.collider_shape_indices, range);
+
+	result["local_velocity_at_position"] = to_packed<PackedVector3Array>(
+		contacts.velocities,
+		range
+	);
+
+	result["collider_velocity_at_position"] = to_packed<PackedVector3Array>(
+		contacts.collider_velocities,
+		range
+	);
+
+	return result;
 }
 
 void JoltBodyImpl3D::reset_mass_properties() {
@@ -775,7 +789,11 @@ void JoltBodyImpl3D::set_constant_torque(const Vector3& p_torque) {
 }
 
 void JoltBodyImpl3D::add_collision_exception(const RID& p_excepted_body) {
-	exceptions.push_back(p_excepted_body);
+	if (exceptions.ordered_has(p_excepted_body)) {
+		return;
+	}
+
+	exceptions.ordered_insert(p_excepted_body);
 
 	_exceptions_changed();
 }
@@ -787,7 +805,7 @@ void JoltBodyImpl3D::remove_collision_exception(const RID& p_excepted_body) {
 }
 
 bool JoltBodyImpl3D::has_collision_exception(const RID& p_excepted_body) const {
-	return exceptions.find(p_excepted_body) >= 0;
+	return exceptions.ordered_has(p_excepted_body);
 }
 
 TypedArray<RID> JoltBodyImpl3D::get_collision_exceptions() const {
@@ -887,8 +905,6 @@ void JoltBodyImpl3D::pre_step(float p_step, JPH::Body& p_jolt_body) {
 			_pre_step_kinematic(p_step, p_jolt_body);
 		} break;
 	}
-
-	contact_count = 0;
 }
 
 void JoltBodyImpl3D::move_kinematic(float p_step, JPH::Body& p_jolt_body) {
@@ -1113,8 +1129,15 @@ void JoltBodyImpl3D::set_axis_lock(PhysicsServer3D::BodyAxis p_axis, bool p_enab
 }
 
 bool JoltBodyImpl3D::can_interact_with(const JoltBodyImpl3D& p_other) const {
-	return (can_collide_with(p_other) || p_other.can_collide_with(*this)) &&
-		!has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
+	if (!can_collide_with(p_other) && !p_other.can_collide_with(*this)) {
+		return false;
+	}
+
+	if (!has_collision_exceptions() && !p_other.has_collision_exceptions()) {
+		return true;
+	}
+
+	return !has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
 }
 
 bool JoltBodyImpl3D::can_interact_with(const JoltSoftBodyImpl3D& p_other) const {
@@ -1202,6 +1225,10 @@ void JoltBodyImpl3D::_add_to_space() {
 	JPH::BodyInterface& body_iface = space->get_body_iface();
 	JPH::Body* body = body_iface.CreateBody(*jolt_settings);
 
+	if (body == nullptr) {
+		space->release_object_layer(jolt_settings->mObjectLayer);
+	}
+
 	ERR_FAIL_NULL_MSG(
 		body,
 		vformat(
@@ -1215,10 +1242,7 @@ void JoltBodyImpl3D::_add_to_space() {
 
 	jolt_id = body->GetID();
 
-	// HACK(mihe): Since `BODY_STATE_TRANSFORM` will be set right after creation it's more or less
-	// impossible to have a body be sleeping when created, so we default to always starting out as
-	// awake/active.
-	body_iface.AddBody(jolt_id, JPH::EActivation::Activate);
+	space->add_body(jolt_id);
 }
 
 void JoltBodyImpl3D::_integrate_forces(float p_step, JPH::Body& p_jolt_body) {
@@ -1504,6 +1528,7 @@ void JoltBodyImpl3D::_mode_changed() {
 	_update_object_layer();
 	_update_kinematic_transform();
 	_update_mass_properties();
+	_enqueue_pre_step();
 	wake_up();
 }
 
@@ -1530,6 +1555,8 @@ void JoltBodyImpl3D::_space_changed() {
 	_update_joint_constraints();
 	_areas_changed();
 
+	motion_recovery_cache.valid = false;
+
 	sync_state = false;
 }
 
@@ -1561,5 +1588,6 @@ void JoltBodyImpl3D::_axis_lock_changed() {
 
 void JoltBodyImpl3D::_contact_reporting_changed() {
 	_update_possible_kinematic_contacts();
+	_enqueue_pre_step();
 	wake_up();
 }
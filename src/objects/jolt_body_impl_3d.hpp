@@ -2,6 +2,7 @@
 
 #include "objects/jolt_physics_direct_body_state_3d.hpp"
 #include "objects/jolt_shaped_object_impl_3d.hpp"
+#include "spaces/jolt_contact_buffer_3d.hpp"
 
 class JoltAreaImpl3D;
 class JoltJointImpl3D;
@@ -11,28 +12,46 @@ class JoltBodyImpl3D final : public JoltShapedObjectImpl3D {
 public:
 	using DampMode = PhysicsServer3D::BodyDampMode;
 
-	struct Contact {
-		float depth = 0.0f;
+	struct MotionRecoveryCandidate {
+		bool operator==(const MotionRecoveryCandidate& p_other) const {
+			return id == p_other.id && position == p_other.position &&
+				rotation == p_other.rotation && shape == p_other.shape &&
+				priority == p_other.priority;
+		}
 
-		int32_t shape_index = 0;
+		bool operator!=(const MotionRecoveryCandidate& p_other) const {
+			return !(*this == p_other);
+		}
 
-		int32_t collider_shape_index = 0;
+		JPH::RefConst<JPH::Shape> shape;
 
-		ObjectID collider_id;
+		JPH::RVec3 position = {};
 
-		RID collider_rid;
+		JPH::Quat rotation = JPH::Quat::sIdentity();
 
-		Vector3 normal;
+		JPH::BodyID id;
 
-		Vector3 position;
+		float priority = 0.0f;
+	};
+
+	struct MotionRecoveryCache {
+		LocalVector<MotionRecoveryCandidate> candidates;
+
+		JPH::RefConst<JPH::Shape> shape;
+
+		Transform3D transform;
+
+		Vector3 recovery;
+
+		float margin = 0.0f;
 
-		Vector3 collider_position;
+		float reach = 0.0f;
 
-		Vector3 velocity;
+		bool recovered = false;
 
-		Vector3 collider_velocity;
+		bool valid = false;
 
-		Vector3 impulse;
+		std::atomic<bool> in_use = false;
 	};
 
 	JoltBodyImpl3D();
@@ -96,30 +115,19 @@ public:
 
 	void set_center_of_mass_custom(const Vector3& p_center_of_mass);
 
-	int32_t get_max_contacts_reported() const { return contacts.size(); }
+	int32_t get_max_contacts_reported() const { return max_contacts_reported; }
 
 	void set_max_contacts_reported(int32_t p_count);
 
-	int32_t get_contact_count() const { return contact_count; }
+	int32_t get_contact_count() const { return get_contacts().count; }
 
-	const Contact& get_contact(int32_t p_index) { return contacts[p_index]; }
+	JoltContactBuffer3D::Range get_contacts() const;
 
-	bool reports_contacts() const override { return !contacts.is_empty(); }
+	Dictionary get_contacts_packed() const;
 
-	bool reports_all_kinematic_contacts() const;
+	bool reports_contacts() const override { return max_contacts_reported > 0; }
 
-	void add_contact(
-		const JoltBodyImpl3D* p_collider,
-		float p_depth,
-		int32_t p_shape_index,
-		int32_t p_collider_shape_index,
-		const Vector3& p_normal,
-		const Vector3& p_position,
-		const Vector3& p_collider_position,
-		const Vector3& p_velocity,
-		const Vector3& p_collider_velocity,
-		const Vector3& p_impulse
-	);
+	bool reports_all_kinematic_contacts() const;
 
 	void reset_mass_properties();
 
@@ -157,6 +165,8 @@ public:
 
 	void remove_collision_exception(const RID& p_excepted_body);
 
+	bool has_collision_exceptions() const { return !exceptions.is_empty(); }
+
 	bool has_collision_exception(const RID& p_excepted_body) const;
 
 	TypedArray<RID> get_collision_exceptions() const;
@@ -247,6 +257,8 @@ public:
 
 	bool are_axes_locked() const { return locked_axes != 0; }
 
+	MotionRecoveryCache& get_motion_recovery_cache() const { return motion_recovery_cache; }
+
 	bool can_interact_with(const JoltBodyImpl3D& p_other) const override;
 
 	bool can_interact_with(const JoltSoftBodyImpl3D& p_other) const override;
@@ -316,12 +328,14 @@ private:
 
 	LocalVector<RID> exceptions;
 
-	LocalVector<Contact> contacts;
-
 	LocalVector<JoltAreaImpl3D*> areas;
 
 	LocalVector<JoltJointImpl3D*> joints;
 
+	// This is only ever touched by `test_body_motion`, which is given a const body, so we make it
+	// mutable rather than cast the const away at every call site.
+	mutable MotionRecoveryCache motion_recovery_cache;
+
 	Variant custom_integration_userdata;
 
 	Transform3D kinematic_transform;
@@ -366,7 +380,7 @@ private:
 
 	float collision_priority = 1.0f;
 
-	int32_t contact_count = 0;
+	int32_t max_contacts_reported = 0;
 
 	uint32_t locked_axes = 0;
 
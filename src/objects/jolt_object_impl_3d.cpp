@@ -71,8 +71,7 @@ void JoltObjectImpl3D::set_collision_mask(uint32_t p_mask) {
 void JoltObjectImpl3D::_remove_from_space() {
 	QUIET_FAIL_COND(jolt_id.IsInvalid());
 
-	space->get_body_iface().RemoveBody(jolt_id);
-	space->get_body_iface().DestroyBody(jolt_id);
+	space->remove_body(jolt_id);
 
 	jolt_id = {};
 }
@@ -118,11 +117,38 @@ String JoltObjectImpl3D::to_string() const {
 }
 
 void JoltObjectImpl3D::_update_object_layer() {
-	if (space == nullptr) {
+	if (space == nullptr || jolt_id.IsInvalid()) {
 		return;
 	}
 
-	space->get_body_iface().SetObjectLayer(jolt_id, _get_object_layer());
+	JPH::BodyInterface& body_iface = space->get_body_iface();
+
+	// The new layer is mapped before releasing the old one, so that a layer which ends up being
+	// unchanged never gets recycled in between
+	const JPH::ObjectLayer old_object_layer = body_iface.GetObjectLayer(jolt_id);
+	body_iface.SetObjectLayer(jolt_id, _get_object_layer());
+	space->release_object_layer(old_object_layer);
+}
+
+void JoltObjectImpl3D::_enqueue_pre_step() {
+	QUIET_FAIL_NULL(space);
+	QUIET_FAIL_COND(jolt_id.IsInvalid());
+
+	space->enqueue_pre_step(jolt_id);
+}
+
+void JoltObjectImpl3D::_enqueue_post_step() {
+	QUIET_FAIL_NULL(space);
+	QUIET_FAIL_COND(jolt_id.IsInvalid());
+
+	space->enqueue_post_step(jolt_id);
+}
+
+void JoltObjectImpl3D::_enqueue_call_queries() {
+	QUIET_FAIL_NULL(space);
+	QUIET_FAIL_COND(jolt_id.IsInvalid());
+
+	space->enqueue_call_queries(jolt_id);
 }
 
 void JoltObjectImpl3D::_collision_layer_changed() {
@@ -129,6 +129,12 @@ protected:
 
 	void _update_object_layer();
 
+	void _enqueue_pre_step();
+
+	void _enqueue_post_step();
+
+	void _enqueue_call_queries();
+
 	virtual void _collision_layer_changed();
 
 	virtual void _collision_mask_changed();
@@ -1,84 +1,134 @@
 #include "jolt_physics_direct_body_state_3d.hpp"
 
 #include "objects/jolt_body_impl_3d.hpp"
+#include "servers/jolt_physics_server_3d.hpp"
+#include "servers/jolt_project_settings.hpp"
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+// Scripts are free to hold on to a direct body state and use it whenever they like, so much like
+// the server itself we defer any modifications made while the simulation is being stepped on a
+// separate thread, and make any reads wait for the step to finish. Deferred calls look up the body
+// again once synchronized, since it might have been freed by an earlier deferred call. None of this
+// is needed when stepping on the main thread, in which case `threaded_server` is null.
+
+#define DEFER_IF_STEPPING(m_method, ...)                                           \
+	if (unlikely(threaded_server != nullptr && threaded_server->_is_stepping())) { \
+		threaded_server->_defer_until_synced(                                      \
+			[=, server = threaded_server, body_rid = body->get_rid()]() {          \
+				auto* direct_state = static_cast<JoltPhysicsDirectBodyState3D*>(   \
+					server->_body_get_direct_state(body_rid)                       \
+				);                                                                 \
+                                                                                   \
+				if (direct_state != nullptr) {                                     \
+					direct_state->m_method(__VA_ARGS__);                           \
+				}                                                                  \
+			}                                                                      \
+		);                                                                         \
+		return;                                                                    \
+	}                                                                              \
+	const JoltPhysicsServer3D::WriteGuard write_guard(threaded_server)
+
+#define WAIT_IF_STEPPING()                                                         \
+	if (unlikely(threaded_server != nullptr && threaded_server->_is_stepping())) { \
+		threaded_server->_wait_for_step();                                         \
+	} else                                                                         \
+		((void)0)
+
 JoltPhysicsDirectBodyState3D::JoltPhysicsDirectBodyState3D(JoltBodyImpl3D* p_body)
-	: body(p_body) { }
+	: body(p_body) {
+	if (JoltProjectSettings::should_run_on_separate_thread()) {
+		threaded_server = static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton());
+	}
+}
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_total_gravity() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_gravity();
 }
 
 double JoltPhysicsDirectBodyState3D::_get_total_angular_damp() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return (double)body->get_total_angular_damp();
 }
 
 double JoltPhysicsDirectBodyState3D::_get_total_linear_damp() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return (double)body->get_total_linear_damp();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_center_of_mass() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_center_of_mass();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_center_of_mass_local() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_center_of_mass_local();
 }
 
 Basis JoltPhysicsDirectBodyState3D::_get_principal_inertia_axes() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_principal_inertia_axes();
 }
 
 double JoltPhysicsDirectBodyState3D::_get_inverse_mass() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return 1.0 / body->get_mass();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_inverse_inertia() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_inverse_inertia();
 }
 
 Basis JoltPhysicsDirectBodyState3D::_get_inverse_inertia_tensor() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_inverse_inertia_tensor();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_linear_velocity() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_linear_velocity();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_linear_velocity(const Vector3& p_velocity) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_set_linear_velocity, p_velocity);
 	return body->set_linear_velocity(p_velocity);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_angular_velocity() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_angular_velocity();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_angular_velocity(const Vector3& p_velocity) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_set_angular_velocity, p_velocity);
 	return body->set_angular_velocity(p_velocity);
 }
 
 void JoltPhysicsDirectBodyState3D::_set_transform(const Transform3D& p_transform) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_set_transform, p_transform);
 	return body->set_transform(p_transform);
 }
 
 Transform3D JoltPhysicsDirectBodyState3D::_get_transform() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_transform_scaled();
 }
 
@@ -86,11 +136,13 @@ Vector3 JoltPhysicsDirectBodyState3D::_get_velocity_at_local_position(
 	const Vector3& p_local_position
 ) const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_velocity_at_position(body->get_position() + p_local_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_central_impulse(const Vector3& p_impulse) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_apply_central_impulse, p_impulse);
 	return body->apply_central_impulse(p_impulse);
 }
 
@@ -99,31 +151,37 @@ void JoltPhysicsDirectBodyState3D::_apply_impulse(
 	const Vector3& p_position
 ) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_apply_impulse, p_impulse, p_position);
 	return body->apply_impulse(p_impulse, p_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_torque_impulse(const Vector3& p_impulse) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_apply_torque_impulse, p_impulse);
 	return body->apply_torque_impulse(p_impulse);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_central_force(const Vector3& p_force) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_apply_central_force, p_force);
 	return body->apply_central_force(p_force);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_force(const Vector3& p_force, const Vector3& p_position) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_apply_force, p_force, p_position);
 	return body->apply_force(p_force, p_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_apply_torque(const Vector3& p_torque) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_apply_torque, p_torque);
 	return body->apply_torque(p_torque);
 }
 
 void JoltPhysicsDirectBodyState3D::_add_constant_central_force(const Vector3& p_force) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_add_constant_central_force, p_force);
 	return body->add_constant_central_force(p_force);
 }
 
@@ -132,120 +190,152 @@ void JoltPhysicsDirectBodyState3D::_add_constant_force(
 	const Vector3& p_position
 ) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_add_constant_force, p_force, p_position);
 	return body->add_constant_force(p_force, p_position);
 }
 
 void JoltPhysicsDirectBodyState3D::_add_constant_torque(const Vector3& p_torque) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_add_constant_torque, p_torque);
 	return body->add_constant_torque(p_torque);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_constant_force() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_constant_force();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_constant_force(const Vector3& p_force) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_set_constant_force, p_force);
 	return body->set_constant_force(p_force);
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_constant_torque() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_constant_torque();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_constant_torque(const Vector3& p_torque) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_set_constant_torque, p_torque);
 	return body->set_constant_torque(p_torque);
 }
 
 bool JoltPhysicsDirectBodyState3D::_is_sleeping() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->is_sleeping();
 }
 
 void JoltPhysicsDirectBodyState3D::_set_sleep_state(bool p_enabled) {
 	QUIET_FAIL_NULL_ED(body);
+	DEFER_IF_STEPPING(_set_sleep_state, p_enabled);
 	body->set_is_sleeping(p_enabled);
 }
 
 int32_t JoltPhysicsDirectBodyState3D::_get_contact_count() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return body->get_contact_count();
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_local_position(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).position;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->positions[contacts.offset + p_contact_idx];
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_local_normal(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).normal;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->normals[contacts.offset + p_contact_idx];
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_impulse(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).impulse;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->impulses[contacts.offset + p_contact_idx];
 }
 
 int32_t JoltPhysicsDirectBodyState3D::_get_contact_local_shape(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).shape_index;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->shape_indices[contacts.offset + p_contact_idx];
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_local_velocity_at_position(int32_t p_contact_idx
 ) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).velocity;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->velocities[contacts.offset + p_contact_idx];
 }
 
 RID JoltPhysicsDirectBodyState3D::_get_contact_collider(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_rid;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->collider_rids[contacts.offset + p_contact_idx];
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_collider_position(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_position;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->collider_positions[contacts.offset + p_contact_idx];
 }
 
 uint64_t JoltPhysicsDirectBodyState3D::_get_contact_collider_id(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_id;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->collider_ids[contacts.offset + p_contact_idx];
 }
 
 Object* JoltPhysicsDirectBodyState3D::_get_contact_collider_object(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return ObjectDB::get_instance(body->get_contact(p_contact_idx).collider_id);
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return ObjectDB::get_instance(contacts.buffer->collider_ids[contacts.offset + p_contact_idx]);
 }
 
 int32_t JoltPhysicsDirectBodyState3D::_get_contact_collider_shape(int32_t p_contact_idx) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_shape_index;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->collider_shape_indices[contacts.offset + p_contact_idx];
 }
 
 Vector3 JoltPhysicsDirectBodyState3D::_get_contact_collider_velocity_at_position(
 	int32_t p_contact_idx
 ) const {
 	QUIET_FAIL_NULL_D_ED(body);
-	ERR_FAIL_INDEX_D(p_contact_idx, body->get_contact_count());
-	return body->get_contact(p_contact_idx).collider_velocity;
+	WAIT_IF_STEPPING();
+	const JoltContactBuffer3D::Range contacts = body->get_contacts();
+	ERR_FAIL_INDEX_D(p_contact_idx, contacts.count);
+	return contacts.buffer->collider_velocities[contacts.offset + p_contact_idx];
 }
 
 double JoltPhysicsDirectBodyState3D::_get_step() const {
 	QUIET_FAIL_NULL_D_ED(body);
+	WAIT_IF_STEPPING();
 	return (double)body->get_space()->get_last_step();
 }
 
@@ -265,5 +355,7 @@ void JoltPhysicsDirectBodyState3D::_integrate_forces() {
 }
 
 PhysicsDirectSpaceState3D* JoltPhysicsDirectBodyState3D::_get_space_state() {
+	WAIT_IF_STEPPING();
+
 	return body->get_space()->get_direct_state();
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 class JoltBodyImpl3D;
+class JoltPhysicsServer3D;
 
 class JoltPhysicsDirectBodyState3D final : public PhysicsDirectBodyState3DExtension {
 	GDCLASS_NO_WARN(JoltPhysicsDirectBodyState3D, PhysicsDirectBodyState3DExtension)
@@ -107,4 +108,6 @@ public:
 
 private:
 	JoltBodyImpl3D* body = nullptr;
+
+	JoltPhysicsServer3D* threaded_server = nullptr;
 };
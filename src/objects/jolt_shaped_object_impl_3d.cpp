@@ -177,6 +177,10 @@ void JoltShapedObjectImpl3D::update_shape() {
 
 	space->get_body_iface().SetShape(jolt_id, jolt_shape, false, JPH::EActivation::DontActivate);
 
+	space->enqueue_shape_changed(jolt_id);
+
+	_enqueue_post_step();
+
 	_shapes_built();
 }
 
@@ -20,7 +20,11 @@ JoltSoftBodyImpl3D::~JoltSoftBodyImpl3D() {
 }
 
 void JoltSoftBodyImpl3D::add_collision_exception(const RID& p_excepted_body) {
-	exceptions.push_back(p_excepted_body);
+	if (exceptions.ordered_has(p_excepted_body)) {
+		return;
+	}
+
+	exceptions.ordered_insert(p_excepted_body);
 
 	_exceptions_changed();
 }
@@ -32,7 +36,7 @@ void JoltSoftBodyImpl3D::remove_collision_exception(const RID& p_excepted_body)
 }
 
 bool JoltSoftBodyImpl3D::has_collision_exception(const RID& p_excepted_body) const {
-	return exceptions.find(p_excepted_body) >= 0;
+	return exceptions.ordered_has(p_excepted_body);
 }
 
 TypedArray<RID> JoltSoftBodyImpl3D::get_collision_exceptions() const {
@@ -47,13 +51,27 @@ TypedArray<RID> JoltSoftBodyImpl3D::get_collision_exceptions() const {
 }
 
 bool JoltSoftBodyImpl3D::can_interact_with(const JoltBodyImpl3D& p_other) const {
-	return (can_collide_with(p_other) || p_other.can_collide_with(*this)) &&
-		!has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
+	if (!can_collide_with(p_other) && !p_other.can_collide_with(*this)) {
+		return false;
+	}
+
+	if (!has_collision_exceptions() && !p_other.has_collision_exceptions()) {
+		return true;
+	}
+
+	return !has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
 }
 
 bool JoltSoftBodyImpl3D::can_interact_with(const JoltSoftBodyImpl3D& p_other) const {
-	return (can_collide_with(p_other) || p_other.can_collide_with(*this)) &&
-		!has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
+	if (!can_collide_with(p_other) && !p_other.can_collide_with(*this)) {
+		return false;
+	}
+
+	if (!has_collision_exceptions() && !p_other.has_collision_exceptions()) {
+		return true;
+	}
+
+	return !has_collision_exception(p_other.get_rid()) && !p_other.has_collision_exception(rid);
 }
 
 bool JoltSoftBodyImpl3D::can_interact_with(const JoltAreaImpl3D& p_other) const {
@@ -78,10 +96,7 @@ bool JoltSoftBodyImpl3D::is_sleeping() const {
 		return false;
 	}
 
-	const JoltReadableBody3D body = space->read_body(jolt_id);
-	ERR_FAIL_COND_D(body.is_invalid());
-
-	return !body->IsActive();
+	return space->is_body_sleeping(jolt_id);
 }
 
 void JoltSoftBodyImpl3D::set_is_sleeping(bool p_enabled) {
@@ -89,13 +104,7 @@ void JoltSoftBodyImpl3D::set_is_sleeping(bool p_enabled) {
 		return;
 	}
 
-	JPH::BodyInterface& body_iface = space->get_body_iface();
-
-	if (p_enabled) {
-		body_iface.DeactivateBody(jolt_id);
-	} else {
-		body_iface.ActivateBody(jolt_id);
-	}
+	space->set_body_sleeping(jolt_id, p_enabled);
 }
 
 void JoltSoftBodyImpl3D::set_simulation_precision(int32_t p_precision) {
@@ -473,6 +482,10 @@ void JoltSoftBodyImpl3D::_add_to_space() {
 
 	JPH::Body* body = body_iface.CreateSoftBody(*jolt_settings);
 
+	if (body == nullptr) {
+		space->release_object_layer(jolt_settings->mObjectLayer);
+	}
+
 	ERR_FAIL_NULL_MSG(
 		body,
 		vformat(
@@ -486,7 +499,7 @@ void JoltSoftBodyImpl3D::_add_to_space() {
 
 	jolt_id = body->GetID();
 
-	body_iface.AddBody(jolt_id, JPH::EActivation::Activate);
+	space->add_body(jolt_id);
 }
 
 bool JoltSoftBodyImpl3D::_ref_shared_data() {
@@ -22,6 +22,8 @@ public:
 
 	void remove_collision_exception(const RID& p_excepted_body);
 
+	bool has_collision_exceptions() const { return !exceptions.is_empty(); }
+
 	bool has_collision_exception(const RID& p_excepted_body) const;
 
 	TypedArray<RID> get_collision_exceptions() const;
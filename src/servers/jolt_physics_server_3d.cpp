@@ -9,6 +9,7 @@
 #include "objects/jolt_area_impl_3d.hpp"
 #include "objects/jolt_body_impl_3d.hpp"
 #include "objects/jolt_soft_body_impl_3d.hpp"
+#include "servers/jolt_project_settings.hpp"
 #include "shapes/jolt_box_shape_impl_3d.hpp"
 #include "shapes/jolt_capsule_shape_impl_3d.hpp"
 #include "shapes/jolt_concave_polygon_shape_impl_3d.hpp"
@@ -22,6 +23,46 @@
 #include "spaces/jolt_physics_direct_space_state_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+// While the simulation is being stepped on a separate thread, any call that modifies the state of
+// the server gets deferred until the step has been synchronized, and any call that reads from it
+// waits for the step to finish. Only the thread that started the step gets to synchronize it,
+// while any other thread waits for it to have done so, which includes flushing the deferred calls.
+// Calls that do modify the server also hold a write guard, to keep them from overlapping with any
+// queries being run from other threads.
+
+#define DEFER_IF_STEPPING(m_method, ...)                       \
+	if (unlikely(_is_stepping())) {                            \
+		_defer_until_synced([=]() { m_method(__VA_ARGS__); }); \
+		return;                                                \
+	}                                                          \
+	const WriteGuard write_guard(*this)
+
+#define WAIT_IF_STEPPING()          \
+	if (unlikely(_is_stepping())) { \
+		_wait_for_step();           \
+	} else                          \
+		((void)0)
+
+namespace {
+
+// Travel (3), remainder (3), depth (1), safe fraction (1), unsafe fraction (1) and count (1)
+constexpr int32_t MOTION_RESULT_STRIDE = 10;
+
+// Position (3), normal (3), collider velocity (3), collider angular velocity (3), depth (1), local
+// shape (1) and collider shape (1)
+constexpr int32_t MOTION_COLLISION_STRIDE = 15;
+
+constexpr int32_t MIN_MOTIONS_PER_CHUNK = 8;
+
+float* write_vector(float* p_dst, const Vector3& p_vector) {
+	*p_dst++ = (float)p_vector.x;
+	*p_dst++ = (float)p_vector.y;
+	*p_dst++ = (float)p_vector.z;
+	return p_dst;
+}
+
+} // namespace
+
 void JoltPhysicsServer3D::_bind_methods() {
 #ifdef GDJ_CONFIG_EDITOR
 	BIND_METHOD(JoltPhysicsServer3D, dump_debug_snapshots, "dir");
@@ -29,6 +70,35 @@ void JoltPhysicsServer3D::_bind_methods() {
 	BIND_METHOD(JoltPhysicsServer3D, space_dump_debug_snapshot, "space", "dir");
 #endif // GDJ_CONFIG_EDITOR
 
+	BIND_METHOD(JoltPhysicsServer3D, space_flush_pending_bodies, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_optimize_broad_phase, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_temp_memory_high_water_mark, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, space_get_active_body_states, "space");
+
+	BIND_METHOD(JoltPhysicsServer3D, area_get_batch_events, "area");
+	BIND_METHOD(JoltPhysicsServer3D, area_set_batch_events, "area", "enabled");
+
+	BIND_METHOD(JoltPhysicsServer3D, area_set_batched_event_callback, "area", "callback");
+
+	BIND_METHOD(JoltPhysicsServer3D, area_get_pending_events, "area");
+
+	BIND_METHOD(JoltPhysicsServer3D, body_get_contacts_packed, "body");
+
+	BIND_METHOD(
+		JoltPhysicsServer3D,
+		bodies_test_motion,
+		"bodies",
+		"from",
+		"motions",
+		"margins",
+		"max_collisions",
+		"collide_separation_ray",
+		"recovery_as_collision"
+	);
+
 	BIND_METHOD(JoltPhysicsServer3D, joint_get_enabled, "joint");
 	BIND_METHOD(JoltPhysicsServer3D, joint_set_enabled, "joint", "enabled");
 
@@ -139,65 +209,110 @@ JoltPhysicsServer3D::~JoltPhysicsServer3D() {
 }
 
 RID JoltPhysicsServer3D::_world_boundary_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltWorldBoundaryShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltWorldBoundaryShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_separation_ray_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltSeparationRayShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltSeparationRayShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_sphere_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltSphereShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltSphereShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_box_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltBoxShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltBoxShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_capsule_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltCapsuleShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltCapsuleShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_cylinder_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltCylinderShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltCylinderShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_convex_polygon_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltConvexPolygonShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltConvexPolygonShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_concave_polygon_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltConcavePolygonShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltConcavePolygonShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
 RID JoltPhysicsServer3D::_heightmap_shape_create() {
-	JoltShapeImpl3D* shape = memnew(JoltHeightMapShapeImpl3D);
-	RID rid = shape_owner.make_rid(shape);
-	shape->set_rid(rid);
+	const RID rid = shape_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltShapeImpl3D* shape = memnew(JoltHeightMapShapeImpl3D);
+		shape_owner.initialize_rid(rid, shape);
+		shape->set_rid(rid);
+	});
+
 	return rid;
 }
 
@@ -206,13 +321,21 @@ RID JoltPhysicsServer3D::_custom_shape_create() {
 }
 
 void JoltPhysicsServer3D::_shape_set_data(const RID& p_shape, const Variant& p_data) {
+	DEFER_IF_STEPPING(_shape_set_data, p_shape, p_data);
+
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	shape->set_data(p_data);
+
+	// Shapes that aren't attached to anything are otherwise only built once they're first used in
+	// a query, which could be happening on several threads at once
+	shape->try_build();
 }
 
 void JoltPhysicsServer3D::_shape_set_custom_solver_bias(const RID& p_shape, double p_bias) {
+	DEFER_IF_STEPPING(_shape_set_custom_solver_bias, p_shape, p_bias);
+
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
@@ -220,6 +343,8 @@ void JoltPhysicsServer3D::_shape_set_custom_solver_bias(const RID& p_shape, doub
 }
 
 PhysicsServer3D::ShapeType JoltPhysicsServer3D::_shape_get_type(const RID& p_shape) const {
+	WAIT_IF_STEPPING();
+
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
@@ -227,6 +352,8 @@ PhysicsServer3D::ShapeType JoltPhysicsServer3D::_shape_get_type(const RID& p_sha
 }
 
 Variant JoltPhysicsServer3D::_shape_get_data(const RID& p_shape) const {
+	WAIT_IF_STEPPING();
+
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
@@ -234,13 +361,19 @@ Variant JoltPhysicsServer3D::_shape_get_data(const RID& p_shape) const {
 }
 
 void JoltPhysicsServer3D::_shape_set_margin(const RID& p_shape, double p_margin) {
+	DEFER_IF_STEPPING(_shape_set_margin, p_shape, p_margin);
+
 	JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL(shape);
 
 	shape->set_margin((float)p_margin);
+
+	shape->try_build();
 }
 
 double JoltPhysicsServer3D::_shape_get_margin(const RID& p_shape) const {
+	WAIT_IF_STEPPING();
+
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
@@ -248,6 +381,8 @@ double JoltPhysicsServer3D::_shape_get_margin(const RID& p_shape) const {
 }
 
 double JoltPhysicsServer3D::_shape_get_custom_solver_bias(const RID& p_shape) const {
+	WAIT_IF_STEPPING();
+
 	const JoltShapeImpl3D* shape = shape_owner.get_or_null(p_shape);
 	ERR_FAIL_NULL_D(shape);
 
@@ -255,20 +390,26 @@ double JoltPhysicsServer3D::_shape_get_custom_solver_bias(const RID& p_shape) co
 }
 
 RID JoltPhysicsServer3D::_space_create() {
-	JoltSpace3D* space = memnew(JoltSpace3D(job_system));
-	RID rid = space_owner.make_rid(space);
-	space->set_rid(rid);
+	const RID rid = space_owner.allocate_rid();
 
-	const RID default_area_rid = area_create();
-	JoltAreaImpl3D* default_area = area_owner.get_or_null(default_area_rid);
-	ERR_FAIL_NULL_D(default_area);
-	space->set_default_area(default_area);
-	default_area->set_space(space);
+	_create_when_synced([this, rid]() {
+		JoltSpace3D* space = memnew(JoltSpace3D(job_system));
+		space_owner.initialize_rid(rid, space);
+		space->set_rid(rid);
+
+		const RID default_area_rid = area_create();
+		JoltAreaImpl3D* default_area = area_owner.get_or_null(default_area_rid);
+		ERR_FAIL_NULL(default_area);
+		space->set_default_area(default_area);
+		default_area->set_space(space);
+	});
 
 	return rid;
 }
 
 void JoltPhysicsServer3D::_space_set_active(const RID& p_space, bool p_active) {
+	DEFER_IF_STEPPING(_space_set_active, p_space, p_active);
+
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
 
@@ -280,6 +421,8 @@ void JoltPhysicsServer3D::_space_set_active(const RID& p_space, bool p_active) {
 }
 
 bool JoltPhysicsServer3D::_space_is_active(const RID& p_space) const {
+	WAIT_IF_STEPPING();
+
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
 
@@ -291,6 +434,8 @@ void JoltPhysicsServer3D::_space_set_param(
 	SpaceParameter p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(_space_set_param, p_space, p_param, p_value);
+
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
 
@@ -298,6 +443,8 @@ void JoltPhysicsServer3D::_space_set_param(
 }
 
 double JoltPhysicsServer3D::_space_get_param(const RID& p_space, SpaceParameter p_param) const {
+	WAIT_IF_STEPPING();
+
 	const JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
 
@@ -305,6 +452,11 @@ double JoltPhysicsServer3D::_space_get_param(const RID& p_space, SpaceParameter
 }
 
 PhysicsDirectSpaceState3D* JoltPhysicsServer3D::_space_get_direct_state(const RID& p_space) {
+	WAIT_IF_STEPPING();
+
+	// The direct state is created lazily, so this may end up modifying the space
+	const WriteGuard write_guard(*this);
+
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
 
@@ -315,6 +467,8 @@ void JoltPhysicsServer3D::_space_set_debug_contacts(
 	[[maybe_unused]] const RID& p_space,
 	[[maybe_unused]] int32_t p_max_contacts
 ) {
+	DEFER_IF_STEPPING(_space_set_debug_contacts, p_space, p_max_contacts);
+
 #ifdef GDJ_CONFIG_EDITOR
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
@@ -325,6 +479,8 @@ void JoltPhysicsServer3D::_space_set_debug_contacts(
 
 PackedVector3Array JoltPhysicsServer3D::_space_get_contacts([[maybe_unused]] const RID& p_space
 ) const {
+	WAIT_IF_STEPPING();
+
 #ifdef GDJ_CONFIG_EDITOR
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
@@ -336,6 +492,8 @@ PackedVector3Array JoltPhysicsServer3D::_space_get_contacts([[maybe_unused]] con
 }
 
 int32_t JoltPhysicsServer3D::_space_get_contact_count([[maybe_unused]] const RID& p_space) const {
+	WAIT_IF_STEPPING();
+
 #ifdef GDJ_CONFIG_EDITOR
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL_D(space);
@@ -347,13 +505,20 @@ int32_t JoltPhysicsServer3D::_space_get_contact_count([[maybe_unused]] const RID
 }
 
 RID JoltPhysicsServer3D::_area_create() {
-	JoltAreaImpl3D* area = memnew(JoltAreaImpl3D);
-	RID rid = area_owner.make_rid(area);
-	area->set_rid(rid);
+	const RID rid = area_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltAreaImpl3D* area = memnew(JoltAreaImpl3D);
+		area_owner.initialize_rid(rid, area);
+		area->set_rid(rid);
+	});
+
 	return rid;
 }
 
 void JoltPhysicsServer3D::_area_set_space(const RID& p_area, const RID& p_space) {
+	DEFER_IF_STEPPING(_area_set_space, p_area, p_space);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -368,6 +533,8 @@ void JoltPhysicsServer3D::_area_set_space(const RID& p_area, const RID& p_space)
 }
 
 RID JoltPhysicsServer3D::_area_get_space(const RID& p_area) const {
+	WAIT_IF_STEPPING();
+
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
@@ -386,6 +553,8 @@ void JoltPhysicsServer3D::_area_add_shape(
 	const Transform3D& p_transform,
 	bool p_disabled
 ) {
+	DEFER_IF_STEPPING(_area_add_shape, p_area, p_shape, p_transform, p_disabled);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -400,6 +569,8 @@ void JoltPhysicsServer3D::_area_set_shape(
 	int32_t p_shape_idx,
 	const RID& p_shape
 ) {
+	DEFER_IF_STEPPING(_area_set_shape, p_area, p_shape_idx, p_shape);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -414,6 +585,8 @@ void JoltPhysicsServer3D::_area_set_shape_transform(
 	int32_t p_shape_idx,
 	const Transform3D& p_transform
 ) {
+	DEFER_IF_STEPPING(_area_set_shape_transform, p_area, p_shape_idx, p_transform);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -421,6 +594,8 @@ void JoltPhysicsServer3D::_area_set_shape_transform(
 }
 
 int32_t JoltPhysicsServer3D::_area_get_shape_count(const RID& p_area) const {
+	WAIT_IF_STEPPING();
+
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
@@ -428,6 +603,8 @@ int32_t JoltPhysicsServer3D::_area_get_shape_count(const RID& p_area) const {
 }
 
 RID JoltPhysicsServer3D::_area_get_shape(const RID& p_area, int32_t p_shape_idx) const {
+	WAIT_IF_STEPPING();
+
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
@@ -439,6 +616,8 @@ RID JoltPhysicsServer3D::_area_get_shape(const RID& p_area, int32_t p_shape_idx)
 
 Transform3D JoltPhysicsServer3D::_area_get_shape_transform(const RID& p_area, int32_t p_shape_idx)
 	const {
+	WAIT_IF_STEPPING();
+
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
@@ -446,6 +625,8 @@ Transform3D JoltPhysicsServer3D::_area_get_shape_transform(const RID& p_area, in
 }
 
 void JoltPhysicsServer3D::_area_remove_shape(const RID& p_area, int32_t p_shape_idx) {
+	DEFER_IF_STEPPING(_area_remove_shape, p_area, p_shape_idx);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -453,6 +634,8 @@ void JoltPhysicsServer3D::_area_remove_shape(const RID& p_area, int32_t p_shape_
 }
 
 void JoltPhysicsServer3D::_area_clear_shapes(const RID& p_area) {
+	DEFER_IF_STEPPING(_area_clear_shapes, p_area);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -464,6 +647,8 @@ void JoltPhysicsServer3D::_area_set_shape_disabled(
 	int32_t p_shape_idx,
 	bool p_disabled
 ) {
+	DEFER_IF_STEPPING(_area_set_shape_disabled, p_area, p_shape_idx, p_disabled);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -471,6 +656,8 @@ void JoltPhysicsServer3D::_area_set_shape_disabled(
 }
 
 void JoltPhysicsServer3D::_area_attach_object_instance_id(const RID& p_area, uint64_t p_id) {
+	DEFER_IF_STEPPING(_area_attach_object_instance_id, p_area, p_id);
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -485,6 +672,8 @@ void JoltPhysicsServer3D::_area_attach_object_instance_id(const RID& p_area, uin
 }
 
 uint64_t JoltPhysicsServer3D::_area_get_object_instance_id(const RID& p_area) const {
+	WAIT_IF_STEPPING();
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -503,6 +692,8 @@ void JoltPhysicsServer3D::_area_set_param(
 	AreaParameter p_param,
 	const Variant& p_value
 ) {
+	DEFER_IF_STEPPING(_area_set_param, p_area, p_param, p_value);
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -517,6 +708,8 @@ void JoltPhysicsServer3D::_area_set_param(
 }
 
 void JoltPhysicsServer3D::_area_set_transform(const RID& p_area, const Transform3D& p_transform) {
+	DEFER_IF_STEPPING(_area_set_transform, p_area, p_transform);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -524,6 +717,8 @@ void JoltPhysicsServer3D::_area_set_transform(const RID& p_area, const Transform
 }
 
 Variant JoltPhysicsServer3D::_area_get_param(const RID& p_area, AreaParameter p_param) const {
+	WAIT_IF_STEPPING();
+
 	RID area_rid = p_area;
 
 	if (space_owner.owns(area_rid)) {
@@ -538,6 +733,8 @@ Variant JoltPhysicsServer3D::_area_get_param(const RID& p_area, AreaParameter p_
 }
 
 Transform3D JoltPhysicsServer3D::_area_get_transform(const RID& p_area) const {
+	WAIT_IF_STEPPING();
+
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
@@ -545,6 +742,8 @@ Transform3D JoltPhysicsServer3D::_area_get_transform(const RID& p_area) const {
 }
 
 void JoltPhysicsServer3D::_area_set_collision_mask(const RID& p_area, uint32_t p_mask) {
+	DEFER_IF_STEPPING(_area_set_collision_mask, p_area, p_mask);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -552,6 +751,8 @@ void JoltPhysicsServer3D::_area_set_collision_mask(const RID& p_area, uint32_t p
 }
 
 uint32_t JoltPhysicsServer3D::_area_get_collision_mask(const RID& p_area) const {
+	WAIT_IF_STEPPING();
+
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
@@ -559,6 +760,8 @@ uint32_t JoltPhysicsServer3D::_area_get_collision_mask(const RID& p_area) const
 }
 
 void JoltPhysicsServer3D::_area_set_collision_layer(const RID& p_area, uint32_t p_layer) {
+	DEFER_IF_STEPPING(_area_set_collision_layer, p_area, p_layer);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -566,6 +769,8 @@ void JoltPhysicsServer3D::_area_set_collision_layer(const RID& p_area, uint32_t
 }
 
 uint32_t JoltPhysicsServer3D::_area_get_collision_layer(const RID& p_area) const {
+	WAIT_IF_STEPPING();
+
 	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL_D(area);
 
@@ -573,6 +778,8 @@ uint32_t JoltPhysicsServer3D::_area_get_collision_layer(const RID& p_area) const
 }
 
 void JoltPhysicsServer3D::_area_set_monitorable(const RID& p_area, bool p_monitorable) {
+	DEFER_IF_STEPPING(_area_set_monitorable, p_area, p_monitorable);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -583,6 +790,8 @@ void JoltPhysicsServer3D::_area_set_monitor_callback(
 	const RID& p_area,
 	const Callable& p_callback
 ) {
+	DEFER_IF_STEPPING(_area_set_monitor_callback, p_area, p_callback);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -593,6 +802,8 @@ void JoltPhysicsServer3D::_area_set_area_monitor_callback(
 	const RID& p_area,
 	const Callable& p_callback
 ) {
+	DEFER_IF_STEPPING(_area_set_area_monitor_callback, p_area, p_callback);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -600,6 +811,8 @@ void JoltPhysicsServer3D::_area_set_area_monitor_callback(
 }
 
 void JoltPhysicsServer3D::_area_set_ray_pickable(const RID& p_area, bool p_enable) {
+	DEFER_IF_STEPPING(_area_set_ray_pickable, p_area, p_enable);
+
 	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
 	ERR_FAIL_NULL(area);
 
@@ -607,13 +820,20 @@ void JoltPhysicsServer3D::_area_set_ray_pickable(const RID& p_area, bool p_enabl
 }
 
 RID JoltPhysicsServer3D::_body_create() {
-	JoltBodyImpl3D* body = memnew(JoltBodyImpl3D);
-	RID rid = body_owner.make_rid(body);
-	body->set_rid(rid);
+	const RID rid = body_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltBodyImpl3D* body = memnew(JoltBodyImpl3D);
+		body_owner.initialize_rid(rid, body);
+		body->set_rid(rid);
+	});
+
 	return rid;
 }
 
 void JoltPhysicsServer3D::_body_set_space(const RID& p_body, const RID& p_space) {
+	DEFER_IF_STEPPING(_body_set_space, p_body, p_space);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -628,6 +848,8 @@ void JoltPhysicsServer3D::_body_set_space(const RID& p_body, const RID& p_space)
 }
 
 RID JoltPhysicsServer3D::_body_get_space(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -641,6 +863,8 @@ RID JoltPhysicsServer3D::_body_get_space(const RID& p_body) const {
 }
 
 void JoltPhysicsServer3D::_body_set_mode(const RID& p_body, BodyMode p_mode) {
+	DEFER_IF_STEPPING(_body_set_mode, p_body, p_mode);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -648,6 +872,8 @@ void JoltPhysicsServer3D::_body_set_mode(const RID& p_body, BodyMode p_mode) {
 }
 
 PhysicsServer3D::BodyMode JoltPhysicsServer3D::_body_get_mode(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -660,6 +886,8 @@ void JoltPhysicsServer3D::_body_add_shape(
 	const Transform3D& p_transform,
 	bool p_disabled
 ) {
+	DEFER_IF_STEPPING(_body_add_shape, p_body, p_shape, p_transform, p_disabled);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -674,6 +902,8 @@ void JoltPhysicsServer3D::_body_set_shape(
 	int32_t p_shape_idx,
 	const RID& p_shape
 ) {
+	DEFER_IF_STEPPING(_body_set_shape, p_body, p_shape_idx, p_shape);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -688,6 +918,8 @@ void JoltPhysicsServer3D::_body_set_shape_transform(
 	int32_t p_shape_idx,
 	const Transform3D& p_transform
 ) {
+	DEFER_IF_STEPPING(_body_set_shape_transform, p_body, p_shape_idx, p_transform);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -695,6 +927,8 @@ void JoltPhysicsServer3D::_body_set_shape_transform(
 }
 
 int32_t JoltPhysicsServer3D::_body_get_shape_count(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -702,6 +936,8 @@ int32_t JoltPhysicsServer3D::_body_get_shape_count(const RID& p_body) const {
 }
 
 RID JoltPhysicsServer3D::_body_get_shape(const RID& p_body, int32_t p_shape_idx) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -713,6 +949,8 @@ RID JoltPhysicsServer3D::_body_get_shape(const RID& p_body, int32_t p_shape_idx)
 
 Transform3D JoltPhysicsServer3D::_body_get_shape_transform(const RID& p_body, int32_t p_shape_idx)
 	const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -720,6 +958,8 @@ Transform3D JoltPhysicsServer3D::_body_get_shape_transform(const RID& p_body, in
 }
 
 void JoltPhysicsServer3D::_body_remove_shape(const RID& p_body, int32_t p_shape_idx) {
+	DEFER_IF_STEPPING(_body_remove_shape, p_body, p_shape_idx);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -727,6 +967,8 @@ void JoltPhysicsServer3D::_body_remove_shape(const RID& p_body, int32_t p_shape_
 }
 
 void JoltPhysicsServer3D::_body_clear_shapes(const RID& p_body) {
+	DEFER_IF_STEPPING(_body_clear_shapes, p_body);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -738,6 +980,8 @@ void JoltPhysicsServer3D::_body_set_shape_disabled(
 	int32_t p_shape_idx,
 	bool p_disabled
 ) {
+	DEFER_IF_STEPPING(_body_set_shape_disabled, p_body, p_shape_idx, p_disabled);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -745,6 +989,8 @@ void JoltPhysicsServer3D::_body_set_shape_disabled(
 }
 
 void JoltPhysicsServer3D::_body_attach_object_instance_id(const RID& p_body, uint64_t p_id) {
+	DEFER_IF_STEPPING(_body_attach_object_instance_id, p_body, p_id);
+
 	if (JoltBodyImpl3D* body = body_owner.get_or_null(p_body)) {
 		body->set_instance_id(ObjectID(p_id));
 	} else if (JoltSoftBodyImpl3D* soft_body = soft_body_owner.get_or_null(p_body)) {
@@ -755,6 +1001,8 @@ void JoltPhysicsServer3D::_body_attach_object_instance_id(const RID& p_body, uin
 }
 
 uint64_t JoltPhysicsServer3D::_body_get_object_instance_id(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -765,6 +1013,8 @@ void JoltPhysicsServer3D::_body_set_enable_continuous_collision_detection(
 	const RID& p_body,
 	bool p_enable
 ) {
+	DEFER_IF_STEPPING(_body_set_enable_continuous_collision_detection, p_body, p_enable);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -772,6 +1022,8 @@ void JoltPhysicsServer3D::_body_set_enable_continuous_collision_detection(
 }
 
 bool JoltPhysicsServer3D::_body_is_continuous_collision_detection_enabled(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -779,6 +1031,8 @@ bool JoltPhysicsServer3D::_body_is_continuous_collision_detection_enabled(const
 }
 
 void JoltPhysicsServer3D::_body_set_collision_layer(const RID& p_body, uint32_t p_layer) {
+	DEFER_IF_STEPPING(_body_set_collision_layer, p_body, p_layer);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -786,6 +1040,8 @@ void JoltPhysicsServer3D::_body_set_collision_layer(const RID& p_body, uint32_t
 }
 
 uint32_t JoltPhysicsServer3D::_body_get_collision_layer(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -793,6 +1049,8 @@ uint32_t JoltPhysicsServer3D::_body_get_collision_layer(const RID& p_body) const
 }
 
 void JoltPhysicsServer3D::_body_set_collision_mask(const RID& p_body, uint32_t p_mask) {
+	DEFER_IF_STEPPING(_body_set_collision_mask, p_body, p_mask);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -800,6 +1058,8 @@ void JoltPhysicsServer3D::_body_set_collision_mask(const RID& p_body, uint32_t p
 }
 
 uint32_t JoltPhysicsServer3D::_body_get_collision_mask(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -807,6 +1067,8 @@ uint32_t JoltPhysicsServer3D::_body_get_collision_mask(const RID& p_body) const
 }
 
 void JoltPhysicsServer3D::_body_set_collision_priority(const RID& p_body, double p_priority) {
+	DEFER_IF_STEPPING(_body_set_collision_priority, p_body, p_priority);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -814,6 +1076,8 @@ void JoltPhysicsServer3D::_body_set_collision_priority(const RID& p_body, double
 }
 
 double JoltPhysicsServer3D::_body_get_collision_priority(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -839,6 +1103,8 @@ void JoltPhysicsServer3D::_body_set_param(
 	BodyParameter p_param,
 	const Variant& p_value
 ) {
+	DEFER_IF_STEPPING(_body_set_param, p_body, p_param, p_value);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -846,6 +1112,8 @@ void JoltPhysicsServer3D::_body_set_param(
 }
 
 Variant JoltPhysicsServer3D::_body_get_param(const RID& p_body, BodyParameter p_param) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -853,6 +1121,8 @@ Variant JoltPhysicsServer3D::_body_get_param(const RID& p_body, BodyParameter p_
 }
 
 void JoltPhysicsServer3D::_body_reset_mass_properties(const RID& p_body) {
+	DEFER_IF_STEPPING(_body_reset_mass_properties, p_body);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -864,6 +1134,8 @@ void JoltPhysicsServer3D::_body_set_state(
 	BodyState p_state,
 	const Variant& p_value
 ) {
+	DEFER_IF_STEPPING(_body_set_state, p_body, p_state, p_value);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -871,6 +1143,8 @@ void JoltPhysicsServer3D::_body_set_state(
 }
 
 Variant JoltPhysicsServer3D::_body_get_state(const RID& p_body, BodyState p_state) const {
+	WAIT_IF_STEPPING();
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -878,6 +1152,8 @@ Variant JoltPhysicsServer3D::_body_get_state(const RID& p_body, BodyState p_stat
 }
 
 void JoltPhysicsServer3D::_body_apply_central_impulse(const RID& p_body, const Vector3& p_impulse) {
+	DEFER_IF_STEPPING(_body_apply_central_impulse, p_body, p_impulse);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -889,6 +1165,8 @@ void JoltPhysicsServer3D::_body_apply_impulse(
 	const Vector3& p_impulse,
 	const Vector3& p_position
 ) {
+	DEFER_IF_STEPPING(_body_apply_impulse, p_body, p_impulse, p_position);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -896,6 +1174,8 @@ void JoltPhysicsServer3D::_body_apply_impulse(
 }
 
 void JoltPhysicsServer3D::_body_apply_torque_impulse(const RID& p_body, const Vector3& p_impulse) {
+	DEFER_IF_STEPPING(_body_apply_torque_impulse, p_body, p_impulse);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -903,6 +1183,8 @@ void JoltPhysicsServer3D::_body_apply_torque_impulse(const RID& p_body, const Ve
 }
 
 void JoltPhysicsServer3D::_body_apply_central_force(const RID& p_body, const Vector3& p_force) {
+	DEFER_IF_STEPPING(_body_apply_central_force, p_body, p_force);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -914,6 +1196,8 @@ void JoltPhysicsServer3D::_body_apply_force(
 	const Vector3& p_force,
 	const Vector3& p_position
 ) {
+	DEFER_IF_STEPPING(_body_apply_force, p_body, p_force, p_position);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -921,6 +1205,8 @@ void JoltPhysicsServer3D::_body_apply_force(
 }
 
 void JoltPhysicsServer3D::_body_apply_torque(const RID& p_body, const Vector3& p_torque) {
+	DEFER_IF_STEPPING(_body_apply_torque, p_body, p_torque);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -931,6 +1217,8 @@ void JoltPhysicsServer3D::_body_add_constant_central_force(
 	const RID& p_body,
 	const Vector3& p_force
 ) {
+	DEFER_IF_STEPPING(_body_add_constant_central_force, p_body, p_force);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -942,6 +1230,8 @@ void JoltPhysicsServer3D::_body_add_constant_force(
 	const Vector3& p_force,
 	const Vector3& p_position
 ) {
+	DEFER_IF_STEPPING(_body_add_constant_force, p_body, p_force, p_position);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -949,6 +1239,8 @@ void JoltPhysicsServer3D::_body_add_constant_force(
 }
 
 void JoltPhysicsServer3D::_body_add_constant_torque(const RID& p_body, const Vector3& p_torque) {
+	DEFER_IF_STEPPING(_body_add_constant_torque, p_body, p_torque);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -956,6 +1248,8 @@ void JoltPhysicsServer3D::_body_add_constant_torque(const RID& p_body, const Vec
 }
 
 void JoltPhysicsServer3D::_body_set_constant_force(const RID& p_body, const Vector3& p_force) {
+	DEFER_IF_STEPPING(_body_set_constant_force, p_body, p_force);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -963,6 +1257,8 @@ void JoltPhysicsServer3D::_body_set_constant_force(const RID& p_body, const Vect
 }
 
 Vector3 JoltPhysicsServer3D::_body_get_constant_force(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -970,6 +1266,8 @@ Vector3 JoltPhysicsServer3D::_body_get_constant_force(const RID& p_body) const {
 }
 
 void JoltPhysicsServer3D::_body_set_constant_torque(const RID& p_body, const Vector3& p_torque) {
+	DEFER_IF_STEPPING(_body_set_constant_torque, p_body, p_torque);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -977,6 +1275,8 @@ void JoltPhysicsServer3D::_body_set_constant_torque(const RID& p_body, const Vec
 }
 
 Vector3 JoltPhysicsServer3D::_body_get_constant_torque(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -987,6 +1287,8 @@ void JoltPhysicsServer3D::_body_set_axis_velocity(
 	const RID& p_body,
 	const Vector3& p_axis_velocity
 ) {
+	DEFER_IF_STEPPING(_body_set_axis_velocity, p_body, p_axis_velocity);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -994,6 +1296,8 @@ void JoltPhysicsServer3D::_body_set_axis_velocity(
 }
 
 void JoltPhysicsServer3D::_body_set_axis_lock(const RID& p_body, BodyAxis p_axis, bool p_lock) {
+	DEFER_IF_STEPPING(_body_set_axis_lock, p_body, p_axis, p_lock);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1001,6 +1305,8 @@ void JoltPhysicsServer3D::_body_set_axis_lock(const RID& p_body, BodyAxis p_axis
 }
 
 bool JoltPhysicsServer3D::_body_is_axis_locked(const RID& p_body, BodyAxis p_axis) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1011,6 +1317,8 @@ void JoltPhysicsServer3D::_body_add_collision_exception(
 	const RID& p_body,
 	const RID& p_excepted_body
 ) {
+	DEFER_IF_STEPPING(_body_add_collision_exception, p_body, p_excepted_body);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1021,6 +1329,8 @@ void JoltPhysicsServer3D::_body_remove_collision_exception(
 	const RID& p_body,
 	const RID& p_excepted_body
 ) {
+	DEFER_IF_STEPPING(_body_remove_collision_exception, p_body, p_excepted_body);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1028,6 +1338,8 @@ void JoltPhysicsServer3D::_body_remove_collision_exception(
 }
 
 TypedArray<RID> JoltPhysicsServer3D::_body_get_collision_exceptions(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1035,6 +1347,8 @@ TypedArray<RID> JoltPhysicsServer3D::_body_get_collision_exceptions(const RID& p
 }
 
 void JoltPhysicsServer3D::_body_set_max_contacts_reported(const RID& p_body, int32_t p_amount) {
+	DEFER_IF_STEPPING(_body_set_max_contacts_reported, p_body, p_amount);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1042,6 +1356,8 @@ void JoltPhysicsServer3D::_body_set_max_contacts_reported(const RID& p_body, int
 }
 
 int32_t JoltPhysicsServer3D::_body_get_max_contacts_reported(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1065,6 +1381,8 @@ double JoltPhysicsServer3D::_body_get_contacts_reported_depth_threshold(
 }
 
 void JoltPhysicsServer3D::_body_set_omit_force_integration(const RID& p_body, bool p_enable) {
+	DEFER_IF_STEPPING(_body_set_omit_force_integration, p_body, p_enable);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1072,6 +1390,8 @@ void JoltPhysicsServer3D::_body_set_omit_force_integration(const RID& p_body, bo
 }
 
 bool JoltPhysicsServer3D::_body_is_omitting_force_integration(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1082,6 +1402,8 @@ void JoltPhysicsServer3D::_body_set_state_sync_callback(
 	const RID& p_body,
 	const Callable& p_callable
 ) {
+	DEFER_IF_STEPPING(_body_set_state_sync_callback, p_body, p_callable);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1093,6 +1415,8 @@ void JoltPhysicsServer3D::_body_set_force_integration_callback(
 	const Callable& p_callable,
 	const Variant& p_userdata
 ) {
+	DEFER_IF_STEPPING(_body_set_force_integration_callback, p_body, p_callable, p_userdata);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1100,6 +1424,8 @@ void JoltPhysicsServer3D::_body_set_force_integration_callback(
 }
 
 void JoltPhysicsServer3D::_body_set_ray_pickable(const RID& p_body, bool p_enable) {
+	DEFER_IF_STEPPING(_body_set_ray_pickable, p_body, p_enable);
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1116,12 +1442,16 @@ bool JoltPhysicsServer3D::_body_test_motion(
 	bool p_recovery_as_collision,
 	PhysicsServer3DExtensionMotionResult* p_result
 ) const {
+	WAIT_IF_STEPPING();
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
 	JoltSpace3D* space = body->get_space();
 	ERR_FAIL_NULL_D(space);
 
+	const ReadGuard read_guard(*space);
+
 	return space->get_direct_state()->test_body_motion(
 		*body,
 		p_from,
@@ -1130,11 +1460,14 @@ bool JoltPhysicsServer3D::_body_test_motion(
 		p_max_collisions,
 		p_collide_separation_ray,
 		p_recovery_as_collision,
+		true,
 		p_result
 	);
 }
 
 PhysicsDirectBodyState3D* JoltPhysicsServer3D::_body_get_direct_state(const RID& p_body) {
+	WAIT_IF_STEPPING();
+
 	JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
 
 	// Unlike most other server methods this one is meant to quietly return null if the body has
@@ -1146,9 +1479,14 @@ PhysicsDirectBodyState3D* JoltPhysicsServer3D::_body_get_direct_state(const RID&
 }
 
 RID JoltPhysicsServer3D::_soft_body_create() {
-	JoltSoftBodyImpl3D* body = memnew(JoltSoftBodyImpl3D);
-	RID rid = soft_body_owner.make_rid(body);
-	body->set_rid(rid);
+	const RID rid = soft_body_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltSoftBodyImpl3D* body = memnew(JoltSoftBodyImpl3D);
+		soft_body_owner.initialize_rid(rid, body);
+		body->set_rid(rid);
+	});
+
 	return rid;
 }
 
@@ -1156,6 +1494,8 @@ void JoltPhysicsServer3D::_soft_body_update_rendering_server(
 	const RID& p_body,
 	PhysicsServer3DRenderingServerHandler* p_rendering_server_handler
 ) {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1163,6 +1503,8 @@ void JoltPhysicsServer3D::_soft_body_update_rendering_server(
 }
 
 void JoltPhysicsServer3D::_soft_body_set_space(const RID& p_body, const RID& p_space) {
+	DEFER_IF_STEPPING(_soft_body_set_space, p_body, p_space);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1177,6 +1519,8 @@ void JoltPhysicsServer3D::_soft_body_set_space(const RID& p_body, const RID& p_s
 }
 
 RID JoltPhysicsServer3D::_soft_body_get_space(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1190,6 +1534,8 @@ RID JoltPhysicsServer3D::_soft_body_get_space(const RID& p_body) const {
 }
 
 void JoltPhysicsServer3D::_soft_body_set_mesh(const RID& p_body, const RID& p_mesh) {
+	DEFER_IF_STEPPING(_soft_body_set_mesh, p_body, p_mesh);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1197,6 +1543,8 @@ void JoltPhysicsServer3D::_soft_body_set_mesh(const RID& p_body, const RID& p_me
 }
 
 AABB JoltPhysicsServer3D::_soft_body_get_bounds(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1204,6 +1552,8 @@ AABB JoltPhysicsServer3D::_soft_body_get_bounds(const RID& p_body) const {
 }
 
 void JoltPhysicsServer3D::_soft_body_set_collision_layer(const RID& p_body, uint32_t p_layer) {
+	DEFER_IF_STEPPING(_soft_body_set_collision_layer, p_body, p_layer);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1211,6 +1561,8 @@ void JoltPhysicsServer3D::_soft_body_set_collision_layer(const RID& p_body, uint
 }
 
 uint32_t JoltPhysicsServer3D::_soft_body_get_collision_layer(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1218,6 +1570,8 @@ uint32_t JoltPhysicsServer3D::_soft_body_get_collision_layer(const RID& p_body)
 }
 
 void JoltPhysicsServer3D::_soft_body_set_collision_mask(const RID& p_body, uint32_t p_mask) {
+	DEFER_IF_STEPPING(_soft_body_set_collision_mask, p_body, p_mask);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1225,6 +1579,8 @@ void JoltPhysicsServer3D::_soft_body_set_collision_mask(const RID& p_body, uint3
 }
 
 uint32_t JoltPhysicsServer3D::_soft_body_get_collision_mask(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1235,6 +1591,8 @@ void JoltPhysicsServer3D::_soft_body_add_collision_exception(
 	const RID& p_body,
 	const RID& p_excepted_body
 ) {
+	DEFER_IF_STEPPING(_soft_body_add_collision_exception, p_body, p_excepted_body);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1245,6 +1603,8 @@ void JoltPhysicsServer3D::_soft_body_remove_collision_exception(
 	const RID& p_body,
 	const RID& p_excepted_body
 ) {
+	DEFER_IF_STEPPING(_soft_body_remove_collision_exception, p_body, p_excepted_body);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1252,6 +1612,8 @@ void JoltPhysicsServer3D::_soft_body_remove_collision_exception(
 }
 
 TypedArray<RID> JoltPhysicsServer3D::_soft_body_get_collision_exceptions(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	const JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1263,6 +1625,8 @@ void JoltPhysicsServer3D::_soft_body_set_state(
 	BodyState p_state,
 	const Variant& p_value
 ) {
+	DEFER_IF_STEPPING(_soft_body_set_state, p_body, p_state, p_value);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1270,6 +1634,8 @@ void JoltPhysicsServer3D::_soft_body_set_state(
 }
 
 Variant JoltPhysicsServer3D::_soft_body_get_state(const RID& p_body, BodyState p_state) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1280,6 +1646,8 @@ void JoltPhysicsServer3D::_soft_body_set_transform(
 	const RID& p_body,
 	const Transform3D& p_transform
 ) {
+	DEFER_IF_STEPPING(_soft_body_set_transform, p_body, p_transform);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1287,6 +1655,8 @@ void JoltPhysicsServer3D::_soft_body_set_transform(
 }
 
 void JoltPhysicsServer3D::_soft_body_set_ray_pickable(const RID& p_body, bool p_enable) {
+	DEFER_IF_STEPPING(_soft_body_set_ray_pickable, p_body, p_enable);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1297,6 +1667,8 @@ void JoltPhysicsServer3D::_soft_body_set_simulation_precision(
 	const RID& p_body,
 	int32_t p_precision
 ) {
+	DEFER_IF_STEPPING(_soft_body_set_simulation_precision, p_body, p_precision);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1304,6 +1676,8 @@ void JoltPhysicsServer3D::_soft_body_set_simulation_precision(
 }
 
 int32_t JoltPhysicsServer3D::_soft_body_get_simulation_precision(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1311,6 +1685,8 @@ int32_t JoltPhysicsServer3D::_soft_body_get_simulation_precision(const RID& p_bo
 }
 
 void JoltPhysicsServer3D::_soft_body_set_total_mass(const RID& p_body, double p_total_mass) {
+	DEFER_IF_STEPPING(_soft_body_set_total_mass, p_body, p_total_mass);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1318,6 +1694,8 @@ void JoltPhysicsServer3D::_soft_body_set_total_mass(const RID& p_body, double p_
 }
 
 double JoltPhysicsServer3D::_soft_body_get_total_mass(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1325,6 +1703,8 @@ double JoltPhysicsServer3D::_soft_body_get_total_mass(const RID& p_body) const {
 }
 
 void JoltPhysicsServer3D::_soft_body_set_linear_stiffness(const RID& p_body, double p_coefficient) {
+	DEFER_IF_STEPPING(_soft_body_set_linear_stiffness, p_body, p_coefficient);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1332,6 +1712,8 @@ void JoltPhysicsServer3D::_soft_body_set_linear_stiffness(const RID& p_body, dou
 }
 
 double JoltPhysicsServer3D::_soft_body_get_linear_stiffness(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1342,6 +1724,8 @@ void JoltPhysicsServer3D::_soft_body_set_pressure_coefficient(
 	const RID& p_body,
 	double p_coefficient
 ) {
+	DEFER_IF_STEPPING(_soft_body_set_pressure_coefficient, p_body, p_coefficient);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1349,6 +1733,8 @@ void JoltPhysicsServer3D::_soft_body_set_pressure_coefficient(
 }
 
 double JoltPhysicsServer3D::_soft_body_get_pressure_coefficient(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1359,6 +1745,8 @@ void JoltPhysicsServer3D::_soft_body_set_damping_coefficient(
 	const RID& p_body,
 	double p_coefficient
 ) {
+	DEFER_IF_STEPPING(_soft_body_set_damping_coefficient, p_body, p_coefficient);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1366,6 +1754,8 @@ void JoltPhysicsServer3D::_soft_body_set_damping_coefficient(
 }
 
 double JoltPhysicsServer3D::_soft_body_get_damping_coefficient(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1373,6 +1763,8 @@ double JoltPhysicsServer3D::_soft_body_get_damping_coefficient(const RID& p_body
 }
 
 void JoltPhysicsServer3D::_soft_body_set_drag_coefficient(const RID& p_body, double p_coefficient) {
+	DEFER_IF_STEPPING(_soft_body_set_drag_coefficient, p_body, p_coefficient);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1380,6 +1772,8 @@ void JoltPhysicsServer3D::_soft_body_set_drag_coefficient(const RID& p_body, dou
 }
 
 double JoltPhysicsServer3D::_soft_body_get_drag_coefficient(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1391,6 +1785,8 @@ void JoltPhysicsServer3D::_soft_body_move_point(
 	int32_t p_point_index,
 	const Vector3& p_global_position
 ) {
+	DEFER_IF_STEPPING(_soft_body_move_point, p_body, p_point_index, p_global_position);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1401,6 +1797,8 @@ Vector3 JoltPhysicsServer3D::_soft_body_get_point_global_position(
 	const RID& p_body,
 	int32_t p_point_index
 ) const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1408,6 +1806,8 @@ Vector3 JoltPhysicsServer3D::_soft_body_get_point_global_position(
 }
 
 void JoltPhysicsServer3D::_soft_body_remove_all_pinned_points(const RID& p_body) {
+	DEFER_IF_STEPPING(_soft_body_remove_all_pinned_points, p_body);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1419,6 +1819,8 @@ void JoltPhysicsServer3D::_soft_body_pin_point(
 	int32_t p_point_index,
 	bool p_pin
 ) {
+	DEFER_IF_STEPPING(_soft_body_pin_point, p_body, p_point_index, p_pin);
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL(body);
 
@@ -1431,6 +1833,8 @@ void JoltPhysicsServer3D::_soft_body_pin_point(
 
 bool JoltPhysicsServer3D::_soft_body_is_point_pinned(const RID& p_body, int32_t p_point_index)
 	const {
+	WAIT_IF_STEPPING();
+
 	JoltSoftBodyImpl3D* body = soft_body_owner.get_or_null(p_body);
 	ERR_FAIL_NULL_D(body);
 
@@ -1438,13 +1842,20 @@ bool JoltPhysicsServer3D::_soft_body_is_point_pinned(const RID& p_body, int32_t
 }
 
 RID JoltPhysicsServer3D::_joint_create() {
-	JoltJointImpl3D* joint = memnew(JoltJointImpl3D);
-	RID rid = joint_owner.make_rid(joint);
-	joint->set_rid(rid);
+	const RID rid = joint_owner.allocate_rid();
+
+	_create_when_synced([this, rid]() {
+		JoltJointImpl3D* joint = memnew(JoltJointImpl3D);
+		joint_owner.initialize_rid(rid, joint);
+		joint->set_rid(rid);
+	});
+
 	return rid;
 }
 
 void JoltPhysicsServer3D::_joint_clear(const RID& p_joint) {
+	DEFER_IF_STEPPING(_joint_clear, p_joint);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1464,6 +1875,8 @@ void JoltPhysicsServer3D::_joint_make_pin(
 	const RID& p_body_b,
 	const Vector3& p_local_b
 ) {
+	DEFER_IF_STEPPING(_joint_make_pin, p_joint, p_body_a, p_local_a, p_body_b, p_local_b);
+
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
@@ -1486,6 +1899,8 @@ void JoltPhysicsServer3D::_pin_joint_set_param(
 	PinJointParam p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(_pin_joint_set_param, p_joint, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1496,6 +1911,8 @@ void JoltPhysicsServer3D::_pin_joint_set_param(
 }
 
 double JoltPhysicsServer3D::_pin_joint_get_param(const RID& p_joint, PinJointParam p_param) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1506,6 +1923,8 @@ double JoltPhysicsServer3D::_pin_joint_get_param(const RID& p_joint, PinJointPar
 }
 
 void JoltPhysicsServer3D::_pin_joint_set_local_a(const RID& p_joint, const Vector3& p_local_a) {
+	DEFER_IF_STEPPING(_pin_joint_set_local_a, p_joint, p_local_a);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1516,6 +1935,8 @@ void JoltPhysicsServer3D::_pin_joint_set_local_a(const RID& p_joint, const Vecto
 }
 
 Vector3 JoltPhysicsServer3D::_pin_joint_get_local_a(const RID& p_joint) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1526,6 +1947,8 @@ Vector3 JoltPhysicsServer3D::_pin_joint_get_local_a(const RID& p_joint) const {
 }
 
 void JoltPhysicsServer3D::_pin_joint_set_local_b(const RID& p_joint, const Vector3& p_local_b) {
+	DEFER_IF_STEPPING(_pin_joint_set_local_b, p_joint, p_local_b);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1536,6 +1959,8 @@ void JoltPhysicsServer3D::_pin_joint_set_local_b(const RID& p_joint, const Vecto
 }
 
 Vector3 JoltPhysicsServer3D::_pin_joint_get_local_b(const RID& p_joint) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1552,6 +1977,8 @@ void JoltPhysicsServer3D::_joint_make_hinge(
 	const RID& p_body_b,
 	const Transform3D& p_hinge_b
 ) {
+	DEFER_IF_STEPPING(_joint_make_hinge, p_joint, p_body_a, p_hinge_a, p_body_b, p_hinge_b);
+
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
@@ -1588,6 +2015,8 @@ void JoltPhysicsServer3D::_hinge_joint_set_param(
 	HingeJointParam p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(_hinge_joint_set_param, p_joint, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1599,6 +2028,8 @@ void JoltPhysicsServer3D::_hinge_joint_set_param(
 
 double JoltPhysicsServer3D::_hinge_joint_get_param(const RID& p_joint, HingeJointParam p_param)
 	const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1613,6 +2044,8 @@ void JoltPhysicsServer3D::_hinge_joint_set_flag(
 	HingeJointFlag p_flag,
 	bool p_enabled
 ) {
+	DEFER_IF_STEPPING(_hinge_joint_set_flag, p_joint, p_flag, p_enabled);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1623,6 +2056,8 @@ void JoltPhysicsServer3D::_hinge_joint_set_flag(
 }
 
 bool JoltPhysicsServer3D::_hinge_joint_get_flag(const RID& p_joint, HingeJointFlag p_flag) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1639,6 +2074,15 @@ void JoltPhysicsServer3D::_joint_make_slider(
 	const RID& p_body_b,
 	const Transform3D& p_local_ref_b
 ) {
+	DEFER_IF_STEPPING(
+		_joint_make_slider,
+		p_joint,
+		p_body_a,
+		p_local_ref_a,
+		p_body_b,
+		p_local_ref_b
+	);
+
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
@@ -1661,6 +2105,8 @@ void JoltPhysicsServer3D::_slider_joint_set_param(
 	SliderJointParam p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(_slider_joint_set_param, p_joint, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1672,6 +2118,8 @@ void JoltPhysicsServer3D::_slider_joint_set_param(
 
 double JoltPhysicsServer3D::_slider_joint_get_param(const RID& p_joint, SliderJointParam p_param)
 	const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1688,6 +2136,15 @@ void JoltPhysicsServer3D::_joint_make_cone_twist(
 	const RID& p_body_b,
 	const Transform3D& p_local_ref_b
 ) {
+	DEFER_IF_STEPPING(
+		_joint_make_cone_twist,
+		p_joint,
+		p_body_a,
+		p_local_ref_a,
+		p_body_b,
+		p_local_ref_b
+	);
+
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
@@ -1710,6 +2167,8 @@ void JoltPhysicsServer3D::_cone_twist_joint_set_param(
 	ConeTwistJointParam p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(_cone_twist_joint_set_param, p_joint, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1723,6 +2182,8 @@ double JoltPhysicsServer3D::_cone_twist_joint_get_param(
 	const RID& p_joint,
 	ConeTwistJointParam p_param
 ) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1739,6 +2200,15 @@ void JoltPhysicsServer3D::_joint_make_generic_6dof(
 	const RID& p_body_b,
 	const Transform3D& p_local_ref_b
 ) {
+	DEFER_IF_STEPPING(
+		_joint_make_generic_6dof,
+		p_joint,
+		p_body_a,
+		p_local_ref_a,
+		p_body_b,
+		p_local_ref_b
+	);
+
 	JoltJointImpl3D* old_joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(old_joint);
 
@@ -1762,6 +2232,8 @@ void JoltPhysicsServer3D::_generic_6dof_joint_set_param(
 	PhysicsServer3D::G6DOFJointAxisParam p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(_generic_6dof_joint_set_param, p_joint, p_axis, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1776,6 +2248,8 @@ double JoltPhysicsServer3D::_generic_6dof_joint_get_param(
 	Vector3::Axis p_axis,
 	PhysicsServer3D::G6DOFJointAxisParam p_param
 ) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1791,6 +2265,8 @@ void JoltPhysicsServer3D::_generic_6dof_joint_set_flag(
 	PhysicsServer3D::G6DOFJointAxisFlag p_flag,
 	bool p_enable
 ) {
+	DEFER_IF_STEPPING(_generic_6dof_joint_set_flag, p_joint, p_axis, p_flag, p_enable);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1805,6 +2281,8 @@ bool JoltPhysicsServer3D::_generic_6dof_joint_get_flag(
 	Vector3::Axis p_axis,
 	PhysicsServer3D::G6DOFJointAxisFlag p_flag
 ) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1815,6 +2293,8 @@ bool JoltPhysicsServer3D::_generic_6dof_joint_get_flag(
 }
 
 PhysicsServer3D::JointType JoltPhysicsServer3D::_joint_get_type(const RID& p_joint) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1822,6 +2302,8 @@ PhysicsServer3D::JointType JoltPhysicsServer3D::_joint_get_type(const RID& p_joi
 }
 
 void JoltPhysicsServer3D::_joint_set_solver_priority(const RID& p_joint, int32_t p_priority) {
+	DEFER_IF_STEPPING(_joint_set_solver_priority, p_joint, p_priority);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1829,6 +2311,8 @@ void JoltPhysicsServer3D::_joint_set_solver_priority(const RID& p_joint, int32_t
 }
 
 int32_t JoltPhysicsServer3D::_joint_get_solver_priority(const RID& p_joint) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1839,6 +2323,8 @@ void JoltPhysicsServer3D::_joint_disable_collisions_between_bodies(
 	const RID& p_joint,
 	bool p_disable
 ) {
+	DEFER_IF_STEPPING(_joint_disable_collisions_between_bodies, p_joint, p_disable);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -1846,6 +2332,8 @@ void JoltPhysicsServer3D::_joint_disable_collisions_between_bodies(
 }
 
 bool JoltPhysicsServer3D::_joint_is_disabled_collisions_between_bodies(const RID& p_joint) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1853,6 +2341,8 @@ bool JoltPhysicsServer3D::_joint_is_disabled_collisions_between_bodies(const RID
 }
 
 void JoltPhysicsServer3D::_free_rid(const RID& p_rid) {
+	DEFER_IF_STEPPING(_free_rid, p_rid);
+
 	if (JoltShapeImpl3D* shape = shape_owner.get_or_null(p_rid)) {
 		free_shape(shape);
 	} else if (JoltBodyImpl3D* body = body_owner.get_or_null(p_rid)) {
@@ -1876,6 +2366,11 @@ void JoltPhysicsServer3D::_set_active(bool p_active) {
 
 void JoltPhysicsServer3D::_init() {
 	job_system = new JoltJobSystem();
+
+	if (JoltProjectSettings::should_run_on_separate_thread()) {
+		step_owner_thread = std::this_thread::get_id();
+		step_thread = std::thread(&JoltPhysicsServer3D::_step_thread_main, this);
+	}
 }
 
 void JoltPhysicsServer3D::_step(double p_step) {
@@ -1883,20 +2378,43 @@ void JoltPhysicsServer3D::_step(double p_step) {
 		return;
 	}
 
-	for (JoltSpace3D* active_space : active_spaces) {
-		job_system->pre_step();
+	_wait_for_step();
+
+	step_delta = (float)p_step;
+
+	if (step_thread.joinable()) {
+		ERR_FAIL_COND_MSG(
+			std::this_thread::get_id() != step_owner_thread,
+			"Failed to step physics server. Steps must be run from the thread that initialized it."
+		);
 
-		active_space->step((float)p_step);
+		step_requested.Release();
+
+		// Other threads rely on the write guard held by the step thread to wait for the step, so we
+		// can't let anyone see us as stepping until the step thread is actually holding it
+		step_started.Acquire();
+
+		stepping.store(true, std::memory_order_release);
+	} else {
+		const WriteGuard write_guard(*this);
 
-		job_system->post_step();
+		_step_spaces();
 	}
 }
 
+void JoltPhysicsServer3D::_sync() {
+	_wait_for_step();
+}
+
 void JoltPhysicsServer3D::_flush_queries() {
 	if (!active) {
 		return;
 	}
 
+	_wait_for_step();
+
+	const WriteGuard write_guard(*this);
+
 	flushing_queries = true;
 
 	for (JoltSpace3D* space : active_spaces) {
@@ -1911,6 +2429,14 @@ void JoltPhysicsServer3D::_flush_queries() {
 }
 
 void JoltPhysicsServer3D::_finish() {
+	if (step_thread.joinable()) {
+		_wait_for_step();
+
+		stopping_step_thread = true;
+		step_requested.Release();
+		step_thread.join();
+	}
+
 	delete_safely(job_system);
 }
 
@@ -1973,12 +2499,16 @@ void JoltPhysicsServer3D::free_joint(JoltJointImpl3D* p_joint) {
 #ifdef GDJ_CONFIG_EDITOR
 
 void JoltPhysicsServer3D::dump_debug_snapshots(const String& p_dir) {
+	WAIT_IF_STEPPING();
+
 	for (JoltSpace3D* space : active_spaces) {
 		space->dump_debug_snapshot(p_dir);
 	}
 }
 
 void JoltPhysicsServer3D::space_dump_debug_snapshot(const RID& p_space, const String& p_dir) {
+	WAIT_IF_STEPPING();
+
 	JoltSpace3D* space = space_owner.get_or_null(p_space);
 	ERR_FAIL_NULL(space);
 
@@ -1987,7 +2517,265 @@ void JoltPhysicsServer3D::space_dump_debug_snapshot(const RID& p_space, const St
 
 #endif // GDJ_CONFIG_EDITOR
 
+void JoltPhysicsServer3D::space_flush_pending_bodies(const RID& p_space) {
+	DEFER_IF_STEPPING(space_flush_pending_bodies, p_space);
+
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->flush_pending_bodies();
+}
+
+void JoltPhysicsServer3D::space_optimize_broad_phase(const RID& p_space) {
+	DEFER_IF_STEPPING(space_optimize_broad_phase, p_space);
+
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL(space);
+
+	space->optimize_broad_phase();
+}
+
+int64_t JoltPhysicsServer3D::space_get_temp_memory_high_water_mark(const RID& p_space) const {
+	WAIT_IF_STEPPING();
+
+	const JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	return (int64_t)space->get_temp_memory_high_water_mark();
+}
+
+Dictionary JoltPhysicsServer3D::space_get_active_body_states(const RID& p_space) const {
+	WAIT_IF_STEPPING();
+
+	JoltSpace3D* space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_D(space);
+
+	// Bodies that have been freed might still be pending removal from the space, in which case
+	// they'd still be active while pointing to an object that no longer exists, so we need the read
+	// guard to flush any pending bodies before reading from them
+	const ReadGuard read_guard(*this, &space, 1);
+
+	return space->get_active_body_states();
+}
+
+bool JoltPhysicsServer3D::area_get_batch_events(const RID& p_area) const {
+	WAIT_IF_STEPPING();
+
+	const JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL_D(area);
+
+	return area->is_batching_events();
+}
+
+void JoltPhysicsServer3D::area_set_batch_events(const RID& p_area, bool p_enabled) {
+	DEFER_IF_STEPPING(area_set_batch_events, p_area, p_enabled);
+
+	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_batching_events(p_enabled);
+}
+
+void JoltPhysicsServer3D::area_set_batched_event_callback(
+	const RID& p_area,
+	const Callable& p_callback
+) {
+	DEFER_IF_STEPPING(area_set_batched_event_callback, p_area, p_callback);
+
+	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL(area);
+
+	area->set_batched_event_callback(p_callback);
+}
+
+Dictionary JoltPhysicsServer3D::area_get_pending_events(const RID& p_area) {
+	WAIT_IF_STEPPING();
+
+	JoltAreaImpl3D* area = area_owner.get_or_null(p_area);
+	ERR_FAIL_NULL_D(area);
+
+	return area->take_pending_events();
+}
+
+Dictionary JoltPhysicsServer3D::body_get_contacts_packed(const RID& p_body) const {
+	WAIT_IF_STEPPING();
+
+	const JoltBodyImpl3D* body = body_owner.get_or_null(p_body);
+	ERR_FAIL_NULL_D(body);
+
+	return body->get_contacts_packed();
+}
+
+Dictionary JoltPhysicsServer3D::bodies_test_motion(
+	const TypedArray<RID>& p_bodies,
+	const TypedArray<Transform3D>& p_from,
+	const PackedVector3Array& p_motions,
+	const PackedFloat32Array& p_margins,
+	int32_t p_max_collisions,
+	bool p_collide_separation_ray,
+	bool p_recovery_as_collision
+) {
+	WAIT_IF_STEPPING();
+
+	const auto motion_count = (int32_t)p_bodies.size();
+
+	ERR_FAIL_COND_D_MSG(
+		p_from.size() != motion_count || p_motions.size() != motion_count ||
+			p_margins.size() != motion_count,
+		"Failed to test body motions. Expected the same number of bodies, transforms, motions and "
+		"margins."
+	);
+
+	p_max_collisions = CLAMP(p_max_collisions, 0, 32);
+
+	struct Motion {
+		JoltBodyImpl3D* body = nullptr;
+
+		JoltPhysicsDirectSpaceState3D* space_state = nullptr;
+
+		Transform3D from;
+
+		PhysicsServer3DExtensionMotionResult result = {};
+	};
+
+	LocalVector<Motion> motions;
+	motions.resize(motion_count);
+
+	LocalVector<JoltSpace3D*> spaces;
+
+	// Anything that might mutate the spaces or shapes, like flushing pending bodies or lazily
+	// creating direct states and shapes, needs exclusive access, so we get all of that out of the
+	// way here, before we start testing motions concurrently.
+	{
+		const WriteGuard write_guard(*this);
+
+		for (int32_t i = 0; i < motion_count; ++i) {
+			Motion& motion = motions[i];
+
+			JoltBodyImpl3D* body = body_owner.get_or_null(p_bodies[i]);
+			ERR_CONTINUE(body == nullptr);
+
+			JoltSpace3D* space = body->get_space();
+			ERR_CONTINUE(space == nullptr);
+
+			if (spaces.find(space) == -1) {
+				space->prepare_for_queries();
+				spaces.push_back(space);
+			}
+
+			for (int32_t j = 0; j < body->get_shape_count(); ++j) {
+				body->get_shape(j)->try_build();
+			}
+
+			motion.body = body;
+			motion.space_state = space->get_direct_state();
+			motion.from = p_from[i];
+		}
+	}
+
+	// The motions themselves only ever read from the spaces, so they can share access with any
+	// other queries, with the read guard making sure that the spaces are still ready for them
+	const ReadGuard read_guard(*this, spaces.ptr(), spaces.size());
+
+	const Vector3* motion_vectors = p_motions.ptr();
+	const float* margins = p_margins.ptr();
+
+	// The exclusions set through `body_test_motion_*` belong to whatever single motion test the
+	// engine is currently running, and can only be queried through calls back into the engine,
+	// neither of which makes any sense for motions tested on worker threads, so we ignore them.
+
+	run_in_job_chunks(
+		*job_system,
+		"bodies_test_motion",
+		motion_count,
+		calculate_job_chunk_count(*job_system, motion_count, MIN_MOTIONS_PER_CHUNK),
+		[&]([[maybe_unused]] int32_t p_chunk, int32_t p_start, int32_t p_end) {
+			for (int32_t i = p_start; i < p_end; ++i) {
+				Motion& motion = motions[i];
+
+				if (motion.body == nullptr) {
+					continue;
+				}
+
+				motion.space_state->test_body_motion(
+					*motion.body,
+					motion.from,
+					motion_vectors[i],
+					margins[i],
+					p_max_collisions,
+					p_collide_separation_ray,
+					p_recovery_as_collision,
+					false,
+					&motion.result
+				);
+			}
+		}
+	);
+
+	// Each motion is written as a record laid out like `PhysicsServer3DExtensionMotionResult`,
+	// followed by `max_collisions` collision records, of which only the first `collision_count`
+	// are meaningful. The object ID and RID of each collider are written to separate arrays, with
+	// `max_collisions` elements per motion, since they can't be represented as floats.
+	const int32_t stride = MOTION_RESULT_STRIDE + p_max_collisions * MOTION_COLLISION_STRIDE;
+
+	PackedFloat32Array results;
+	results.resize((int64_t)motion_count * stride);
+	results.fill(0.0f);
+
+	PackedInt64Array collider_ids;
+	collider_ids.resize((int64_t)motion_count * p_max_collisions);
+	collider_ids.fill(0);
+
+	PackedInt64Array colliders;
+	colliders.resize((int64_t)motion_count * p_max_collisions);
+	colliders.fill(0);
+
+	float* record = results.ptrw();
+	int64_t* collider_id = collider_ids.ptrw();
+	int64_t* collider = colliders.ptrw();
+
+	for (const Motion& motion : motions) {
+		const PhysicsServer3DExtensionMotionResult& result = motion.result;
+
+		float* dst = record;
+		dst = write_vector(dst, result.travel);
+		dst = write_vector(dst, result.remainder);
+		*dst++ = (float)result.collision_depth;
+		*dst++ = (float)result.collision_safe_fraction;
+		*dst++ = (float)result.collision_unsafe_fraction;
+		*dst++ = (float)result.collision_count;
+
+		for (int32_t i = 0; i < result.collision_count; ++i) {
+			const PhysicsServer3DExtensionMotionCollision& collision = result.collisions[i];
+
+			dst = write_vector(dst, collision.position);
+			dst = write_vector(dst, collision.normal);
+			dst = write_vector(dst, collision.collider_velocity);
+			dst = write_vector(dst, collision.collider_angular_velocity);
+			*dst++ = (float)collision.depth;
+			*dst++ = (float)collision.local_shape;
+			*dst++ = (float)collision.collider_shape;
+
+			collider_id[i] = (int64_t)collision.collider_id;
+			collider[i] = (int64_t)collision.collider.get_id();
+		}
+
+		record += stride;
+		collider_id += p_max_collisions;
+		collider += p_max_collisions;
+	}
+
+	Dictionary result;
+	result["results"] = results;
+	result["collider_ids"] = collider_ids;
+	result["colliders"] = colliders;
+
+	return result;
+}
+
 bool JoltPhysicsServer3D::joint_get_enabled(const RID& p_joint) const {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -1995,6 +2783,8 @@ bool JoltPhysicsServer3D::joint_get_enabled(const RID& p_joint) const {
 }
 
 void JoltPhysicsServer3D::joint_set_enabled(const RID& p_joint, bool p_enabled) {
+	DEFER_IF_STEPPING(joint_set_enabled, p_joint, p_enabled);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2002,6 +2792,8 @@ void JoltPhysicsServer3D::joint_set_enabled(const RID& p_joint, bool p_enabled)
 }
 
 int32_t JoltPhysicsServer3D::joint_get_solver_velocity_iterations(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2012,6 +2804,8 @@ void JoltPhysicsServer3D::joint_set_solver_velocity_iterations(
 	const RID& p_joint,
 	int32_t p_value
 ) {
+	DEFER_IF_STEPPING(joint_set_solver_velocity_iterations, p_joint, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2019,6 +2813,8 @@ void JoltPhysicsServer3D::joint_set_solver_velocity_iterations(
 }
 
 int32_t JoltPhysicsServer3D::joint_get_solver_position_iterations(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2029,6 +2825,8 @@ void JoltPhysicsServer3D::joint_set_solver_position_iterations(
 	const RID& p_joint,
 	int32_t p_value
 ) {
+	DEFER_IF_STEPPING(joint_set_solver_position_iterations, p_joint, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2036,6 +2834,8 @@ void JoltPhysicsServer3D::joint_set_solver_position_iterations(
 }
 
 float JoltPhysicsServer3D::pin_joint_get_applied_force(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2049,6 +2849,8 @@ double JoltPhysicsServer3D::hinge_joint_get_jolt_param(
 	const RID& p_joint,
 	HingeJointParamJolt p_param
 ) const {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2063,6 +2865,8 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_param(
 	HingeJointParamJolt p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(hinge_joint_set_jolt_param, p_joint, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2074,6 +2878,8 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_param(
 
 bool JoltPhysicsServer3D::hinge_joint_get_jolt_flag(const RID& p_joint, HingeJointFlagJolt p_flag)
 	const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2088,6 +2894,8 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_flag(
 	HingeJointFlagJolt p_flag,
 	bool p_enabled
 ) {
+	DEFER_IF_STEPPING(hinge_joint_set_jolt_flag, p_joint, p_flag, p_enabled);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2098,6 +2906,8 @@ void JoltPhysicsServer3D::hinge_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::hinge_joint_get_applied_force(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2108,6 +2918,8 @@ float JoltPhysicsServer3D::hinge_joint_get_applied_force(const RID& p_joint) {
 }
 
 float JoltPhysicsServer3D::hinge_joint_get_applied_torque(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2121,6 +2933,8 @@ double JoltPhysicsServer3D::slider_joint_get_jolt_param(
 	const RID& p_joint,
 	SliderJointParamJolt p_param
 ) const {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2135,6 +2949,8 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_param(
 	SliderJointParamJolt p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(slider_joint_set_jolt_param, p_joint, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2146,6 +2962,8 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_param(
 
 bool JoltPhysicsServer3D::slider_joint_get_jolt_flag(const RID& p_joint, SliderJointFlagJolt p_flag)
 	const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2160,6 +2978,8 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_flag(
 	SliderJointFlagJolt p_flag,
 	bool p_enabled
 ) {
+	DEFER_IF_STEPPING(slider_joint_set_jolt_flag, p_joint, p_flag, p_enabled);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2170,6 +2990,8 @@ void JoltPhysicsServer3D::slider_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::slider_joint_get_applied_force(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2180,6 +3002,8 @@ float JoltPhysicsServer3D::slider_joint_get_applied_force(const RID& p_joint) {
 }
 
 float JoltPhysicsServer3D::slider_joint_get_applied_torque(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2193,6 +3017,8 @@ double JoltPhysicsServer3D::cone_twist_joint_get_jolt_param(
 	const RID& p_joint,
 	ConeTwistJointParamJolt p_param
 ) const {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2207,6 +3033,8 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_param(
 	ConeTwistJointParamJolt p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(cone_twist_joint_set_jolt_param, p_joint, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2220,6 +3048,8 @@ bool JoltPhysicsServer3D::cone_twist_joint_get_jolt_flag(
 	const RID& p_joint,
 	ConeTwistJointFlagJolt p_flag
 ) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2234,6 +3064,8 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_flag(
 	ConeTwistJointFlagJolt p_flag,
 	bool p_enabled
 ) {
+	DEFER_IF_STEPPING(cone_twist_joint_set_jolt_flag, p_joint, p_flag, p_enabled);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2244,6 +3076,8 @@ void JoltPhysicsServer3D::cone_twist_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::cone_twist_joint_get_applied_force(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2254,6 +3088,8 @@ float JoltPhysicsServer3D::cone_twist_joint_get_applied_force(const RID& p_joint
 }
 
 float JoltPhysicsServer3D::cone_twist_joint_get_applied_torque(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2268,6 +3104,8 @@ double JoltPhysicsServer3D::generic_6dof_joint_get_jolt_param(
 	Vector3::Axis p_axis,
 	G6DOFJointAxisParamJolt p_param
 ) const {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2283,6 +3121,8 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_param(
 	G6DOFJointAxisParamJolt p_param,
 	double p_value
 ) {
+	DEFER_IF_STEPPING(generic_6dof_joint_set_jolt_param, p_joint, p_axis, p_param, p_value);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2297,6 +3137,8 @@ bool JoltPhysicsServer3D::generic_6dof_joint_get_jolt_flag(
 	Vector3::Axis p_axis,
 	G6DOFJointAxisFlagJolt p_flag
 ) const {
+	WAIT_IF_STEPPING();
+
 	const JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2312,6 +3154,8 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_flag(
 	G6DOFJointAxisFlagJolt p_flag,
 	bool p_enabled
 ) {
+	DEFER_IF_STEPPING(generic_6dof_joint_set_jolt_flag, p_joint, p_axis, p_flag, p_enabled);
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL(joint);
 
@@ -2322,6 +3166,8 @@ void JoltPhysicsServer3D::generic_6dof_joint_set_jolt_flag(
 }
 
 float JoltPhysicsServer3D::generic_6dof_joint_get_applied_force(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2332,6 +3178,8 @@ float JoltPhysicsServer3D::generic_6dof_joint_get_applied_force(const RID& p_joi
 }
 
 float JoltPhysicsServer3D::generic_6dof_joint_get_applied_torque(const RID& p_joint) {
+	WAIT_IF_STEPPING();
+
 	JoltJointImpl3D* joint = joint_owner.get_or_null(p_joint);
 	ERR_FAIL_NULL_D(joint);
 
@@ -2340,3 +3188,271 @@ float JoltPhysicsServer3D::generic_6dof_joint_get_applied_torque(const RID& p_jo
 
 	return g6dof_joint->get_applied_torque();
 }
+
+void JoltPhysicsServer3D::_step_spaces() {
+	// Stepping a space blocks until all of its jobs have finished, so if those jobs were to also
+	// run on the worker thread pool we could end up with every worker blocked on jobs that no
+	// worker is free to run, hence why this requires the native job system
+	const bool step_in_parallel = JoltProjectSettings::should_step_spaces_in_parallel() &&
+		JoltProjectSettings::use_native_job_system();
+
+	if (!step_in_parallel || active_spaces.size() < 2) {
+		for (JoltSpace3D* active_space : active_spaces) {
+			job_system->pre_step();
+
+			active_space->step(step_delta);
+
+			job_system->post_step();
+		}
+
+		return;
+	}
+
+	stepping_spaces.clear();
+
+	for (JoltSpace3D* active_space : active_spaces) {
+		stepping_spaces.push_back(active_space);
+	}
+
+	job_system->pre_step();
+
+	static const String task_name("JoltPhysicsStep");
+
+	WorkerThreadPool* worker_pool = WorkerThreadPool::get_singleton();
+
+	const int64_t group_id = worker_pool->add_native_group_task(
+		&_step_space,
+		this,
+		stepping_spaces.size(),
+		-1,
+		true,
+		task_name
+	);
+
+	worker_pool->wait_for_group_task_completion(group_id);
+
+	job_system->post_step();
+
+	stepping_spaces.clear();
+}
+
+void JoltPhysicsServer3D::_step_space(void* p_user_data, uint32_t p_index) {
+	auto* physics_server = static_cast<JoltPhysicsServer3D*>(p_user_data);
+
+	physics_server->stepping_spaces[(int32_t)p_index]->step(physics_server->step_delta);
+}
+
+void JoltPhysicsServer3D::_step_thread_main() {
+	while (true) {
+		step_requested.Acquire();
+
+		if (stopping_step_thread) {
+			break;
+		}
+
+		{
+			const WriteGuard write_guard(*this);
+
+			step_started.Release();
+
+			_step_spaces();
+		}
+
+		step_completed.Release();
+	}
+}
+
+void JoltPhysicsServer3D::_wait_for_step() const {
+	if (!_is_stepping()) {
+		return;
+	}
+
+	if (std::this_thread::get_id() != step_owner_thread) {
+		// Any thread that's already holding a guard is also keeping the step thread or the deferred
+		// calls from running, and any other thread needs to wait for the deferred calls to have
+		// been flushed, or it might read state that's missing modifications made during the step
+		if (query_lock_depth == 0) {
+			std::unique_lock lock(deferred_calls_mutex);
+
+			synced.wait(lock, [&]() { return !stepping.load(std::memory_order_acquire); });
+		}
+
+		return;
+	}
+
+	step_completed.Acquire();
+
+	flushing_deferred_calls = true;
+
+	LocalVector<std::function<void()>> deferred_calls_to_flush;
+
+	// Other threads keep deferring their calls until we stop stepping, so we keep flushing until
+	// there's nothing left, and only then stop stepping while still holding the lock
+	while (true) {
+		{
+			const std::unique_lock lock(deferred_calls_mutex);
+
+			if (deferred_calls.is_empty()) {
+				stepping.store(false, std::memory_order_release);
+				break;
+			}
+
+			std::swap(deferred_calls_to_flush, deferred_calls);
+		}
+
+		for (const std::function<void()>& deferred_call : deferred_calls_to_flush) {
+			deferred_call();
+		}
+
+		deferred_calls_to_flush.clear();
+	}
+
+	flushing_deferred_calls = false;
+
+	synced.notify_all();
+}
+
+void JoltPhysicsServer3D::_defer_until_synced(std::function<void()>&& p_call) {
+	{
+		const std::unique_lock lock(deferred_calls_mutex);
+
+		if (stepping.load(std::memory_order_acquire)) {
+			deferred_calls.push_back(std::move(p_call));
+			return;
+		}
+	}
+
+	// The step was synchronized after we last checked, so there's nothing left to defer until
+	p_call();
+}
+
+void JoltPhysicsServer3D::_create_when_synced(std::function<void()>&& p_create) {
+	// Creating an object only needs the ID of its RID to be known up front, so rather than waiting
+	// for the write guard held by the step thread we create the object itself once synchronized,
+	// which is fine since any call that makes use of it will also be deferred or wait until then
+	if (unlikely(_is_stepping())) {
+		_defer_until_synced([this, create = std::move(p_create)]() {
+			const WriteGuard write_guard(*this);
+			create();
+		});
+
+		return;
+	}
+
+	const WriteGuard write_guard(*this);
+
+	p_create();
+}
+
+void JoltPhysicsServer3D::_lock_for_reading(
+	JoltSpace3D* const* p_spaces,
+	int32_t p_space_count
+) const {
+	if (query_lock_depth > 0) {
+		query_lock_depth += 1;
+
+		// We already have exclusive access if this is nested within a write guard, such as from
+		// within the callbacks of `_flush_queries`, so any pending bodies can be flushed right away
+		if (query_lock_exclusive) {
+			for (int32_t i = 0; i < p_space_count; ++i) {
+				p_spaces[i]->prepare_for_queries();
+			}
+		}
+
+		return;
+	}
+
+	// Direct space state queries don't go through `WAIT_IF_STEPPING`, so we wait for any ongoing
+	// step here instead, before counting ourselves as holding a guard, since synchronizing the step
+	// will flush any deferred calls, which need to take their own write guards
+	_wait_for_step();
+
+	query_lock_depth = 1;
+
+	query_mutex.lock_shared();
+
+	const auto is_ready_for_queries = [&]() {
+		for (int32_t i = 0; i < p_space_count; ++i) {
+			if (!p_spaces[i]->is_ready_for_queries()) {
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	// Running a query flushes any bodies that are pending to be added or removed, which modifies
+	// the space, so if there are any we briefly trade our shared lock for an exclusive one
+	while (!is_ready_for_queries()) {
+		query_mutex.unlock_shared();
+		query_mutex.lock();
+
+		for (int32_t i = 0; i < p_space_count; ++i) {
+			p_spaces[i]->prepare_for_queries();
+		}
+
+		query_mutex.unlock();
+		query_mutex.lock_shared();
+	}
+
+	query_lock_exclusive = false;
+}
+
+void JoltPhysicsServer3D::_lock_for_writing() const {
+	if (query_lock_depth++ > 0) {
+		return;
+	}
+
+	query_mutex.lock();
+
+	query_lock_exclusive = true;
+}
+
+void JoltPhysicsServer3D::_unlock() const {
+	if (--query_lock_depth > 0) {
+		return;
+	}
+
+	if (query_lock_exclusive) {
+		query_mutex.unlock();
+	} else {
+		query_mutex.unlock_shared();
+	}
+}
+
+JoltPhysicsServer3D::ReadGuard::ReadGuard(JoltSpace3D& p_space)
+	: server(*static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton())) {
+	JoltSpace3D* space = &p_space;
+	server._lock_for_reading(&space, 1);
+}
+
+JoltPhysicsServer3D::ReadGuard::ReadGuard(
+	const JoltPhysicsServer3D& p_server,
+	JoltSpace3D* const* p_spaces,
+	int32_t p_space_count
+)
+	: server(p_server) {
+	server._lock_for_reading(p_spaces, p_space_count);
+}
+
+JoltPhysicsServer3D::ReadGuard::~ReadGuard() {
+	server._unlock();
+}
+
+JoltPhysicsServer3D::WriteGuard::WriteGuard(const JoltPhysicsServer3D& p_server)
+	: server(&p_server) {
+	server->_lock_for_writing();
+}
+
+JoltPhysicsServer3D::WriteGuard::WriteGuard(const JoltPhysicsServer3D* p_server)
+	: server(p_server) {
+	if (server != nullptr) {
+		server->_lock_for_writing();
+	}
+}
+
+JoltPhysicsServer3D::WriteGuard::~WriteGuard() {
+	if (server != nullptr) {
+		server->_unlock();
+	}
+}
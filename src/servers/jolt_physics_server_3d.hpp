@@ -11,6 +11,8 @@ class JoltSpace3D;
 class JoltPhysicsServer3D final : public PhysicsServer3DExtension {
 	GDCLASS_NO_WARN(JoltPhysicsServer3D, PhysicsServer3DExtension)
 
+	friend class JoltPhysicsDirectBodyState3D;
+
 public:
 	enum HingeJointParamJolt {
 		HINGE_JOINT_LIMIT_SPRING_FREQUENCY = 100,
@@ -77,6 +79,55 @@ public:
 		G6DOF_JOINT_FLAG_ENABLE_ANGULAR_SPRING_FREQUENCY,
 	};
 
+	// Any number of threads are allowed to query a space at the same time, so long as the
+	// simulation isn't being stepped and nothing is modifying the server in the meantime. Queries
+	// hold a read guard for as long as they run, while anything that modifies the server holds a
+	// write guard, with both being reentrant on whichever thread is holding them.
+	class ReadGuard {
+	public:
+		explicit ReadGuard(JoltSpace3D& p_space);
+
+		ReadGuard(
+			const JoltPhysicsServer3D& p_server,
+			JoltSpace3D* const* p_spaces,
+			int32_t p_space_count
+		);
+
+		ReadGuard(const ReadGuard& p_other) = delete;
+
+		ReadGuard(ReadGuard&& p_other) = delete;
+
+		~ReadGuard();
+
+		ReadGuard& operator=(const ReadGuard& p_other) = delete;
+
+		ReadGuard& operator=(ReadGuard&& p_other) = delete;
+
+	private:
+		const JoltPhysicsServer3D& server;
+	};
+
+	class WriteGuard {
+	public:
+		explicit WriteGuard(const JoltPhysicsServer3D& p_server);
+
+		// Guards nothing if the server is null
+		explicit WriteGuard(const JoltPhysicsServer3D* p_server);
+
+		WriteGuard(const WriteGuard& p_other) = delete;
+
+		WriteGuard(WriteGuard&& p_other) = delete;
+
+		~WriteGuard();
+
+		WriteGuard& operator=(const WriteGuard& p_other) = delete;
+
+		WriteGuard& operator=(WriteGuard&& p_other) = delete;
+
+	private:
+		const JoltPhysicsServer3D* server = nullptr;
+	};
+
 private:
 	static void _bind_methods();
 
@@ -604,7 +655,7 @@ public:
 
 	void _step(double p_step) override;
 
-	void _sync() override { }
+	void _sync() override;
 
 	void _flush_queries() override;
 
@@ -644,6 +695,34 @@ public:
 	void space_dump_debug_snapshot(const RID& p_space, const String& p_dir);
 #endif // GDJ_CONFIG_EDITOR
 
+	void space_flush_pending_bodies(const RID& p_space);
+
+	void space_optimize_broad_phase(const RID& p_space);
+
+	int64_t space_get_temp_memory_high_water_mark(const RID& p_space) const;
+
+	Dictionary space_get_active_body_states(const RID& p_space) const;
+
+	bool area_get_batch_events(const RID& p_area) const;
+
+	void area_set_batch_events(const RID& p_area, bool p_enabled);
+
+	void area_set_batched_event_callback(const RID& p_area, const Callable& p_callback);
+
+	Dictionary area_get_pending_events(const RID& p_area);
+
+	Dictionary body_get_contacts_packed(const RID& p_body) const;
+
+	Dictionary bodies_test_motion(
+		const TypedArray<RID>& p_bodies,
+		const TypedArray<Transform3D>& p_from,
+		const PackedVector3Array& p_motions,
+		const PackedFloat32Array& p_margins,
+		int32_t p_max_collisions,
+		bool p_collide_separation_ray,
+		bool p_recovery_as_collision
+	);
+
 	bool joint_get_enabled(const RID& p_joint) const;
 
 	void joint_set_enabled(const RID& p_joint, bool p_enabled);
@@ -742,6 +821,34 @@ public:
 	float generic_6dof_joint_get_applied_torque(const RID& p_joint);
 
 private:
+	void _step_spaces();
+
+	static void _step_space(void* p_user_data, uint32_t p_index);
+
+	void _step_thread_main();
+
+	bool _is_stepping() const {
+		return !flushing_deferred_calls && stepping.load(std::memory_order_acquire);
+	}
+
+	void _wait_for_step() const;
+
+	void _defer_until_synced(std::function<void()>&& p_call);
+
+	void _create_when_synced(std::function<void()>&& p_create);
+
+	void _lock_for_reading(JoltSpace3D* const* p_spaces, int32_t p_space_count) const;
+
+	void _lock_for_writing() const;
+
+	void _unlock() const;
+
+	inline static thread_local int32_t query_lock_depth = 0;
+
+	inline static thread_local bool query_lock_exclusive = false;
+
+	inline static thread_local bool flushing_deferred_calls = false;
+
 	mutable RID_PtrOwner<JoltSpace3D> space_owner;
 
 	mutable RID_PtrOwner<JoltAreaImpl3D> area_owner;
@@ -756,11 +863,37 @@ private:
 
 	HashSet<JoltSpace3D*> active_spaces;
 
+	LocalVector<JoltSpace3D*> stepping_spaces;
+
+	mutable LocalVector<std::function<void()>> deferred_calls;
+
+	mutable std::mutex deferred_calls_mutex;
+
+	mutable std::condition_variable synced;
+
+	mutable std::shared_mutex query_mutex;
+
+	std::thread step_thread;
+
+	std::thread::id step_owner_thread;
+
+	JPH::Semaphore step_requested;
+
+	JPH::Semaphore step_started;
+
+	mutable JPH::Semaphore step_completed;
+
 	JoltJobSystem* job_system = nullptr;
 
+	float step_delta = 0.0f;
+
 	bool active = true;
 
 	bool flushing_queries = false;
+
+	mutable std::atomic<bool> stepping = false;
+
+	bool stopping_step_thread = false;
 };
 
 VARIANT_ENUM_CAST(JoltPhysicsServer3D::HingeJointParamJolt)
@@ -7,6 +7,11 @@ enum JointWorldNode : int32_t {
 	JOINT_WORLD_NODE_B
 };
 
+enum JobSystem : int32_t {
+	JOB_SYSTEM_NATIVE,
+	JOB_SYSTEM_WORKER_THREAD_POOL
+};
+
 constexpr char SLEEP_ENABLED[] = "physics/jolt_3d/sleep/enabled";
 constexpr char SLEEP_VELOCITY_THRESHOLD[] = "physics/jolt_3d/sleep/velocity_threshold";
 constexpr char SLEEP_TIME_THRESHOLD[] = "physics/jolt_3d/sleep/time_threshold";
@@ -15,6 +20,8 @@ constexpr char SHAPE_MARGINS[] = "physics/jolt_3d/collisions/use_shape_margins";
 constexpr char EDGE_REMOVAL[] = "physics/jolt_3d/collisions/use_enhanced_internal_edge_removal";
 constexpr char AREAS_DETECT_STATIC[] = "physics/jolt_3d/collisions/areas_detect_static_bodies";
 constexpr char KINEMATIC_CONTACTS[] = "physics/jolt_3d/collisions/report_all_kinematic_contacts";
+constexpr char CONTACT_IMPULSES[] = "physics/jolt_3d/collisions/estimate_contact_impulses";
+constexpr char BROAD_PHASE_REBUILD[] = "physics/jolt_3d/collisions/broad_phase_rebuild_threshold";
 
 constexpr char SOFT_BODY_POINT_MARGIN[] = "physics/jolt_3d/soft_bodies/point_margin";
 
@@ -40,6 +47,10 @@ constexpr char MAX_BODIES[] = "physics/jolt_3d/limits/max_bodies";
 constexpr char MAX_PAIRS[] = "physics/jolt_3d/limits/max_body_pairs";
 constexpr char MAX_CONTACTS[] = "physics/jolt_3d/limits/max_contact_constraints";
 constexpr char MAX_TEMP_MEMORY[] = "physics/jolt_3d/limits/max_temporary_memory";
+constexpr char TEMP_MEMORY_SHRINK_DELAY[] = "physics/jolt_3d/limits/temporary_memory_shrink_delay";
+
+constexpr char JOB_SYSTEM[] = "physics/jolt_3d/threading/job_system";
+constexpr char PARALLEL_SPACES[] = "physics/jolt_3d/threading/step_spaces_in_parallel";
 
 constexpr char RUN_ON_SEPARATE_THREAD[] = "physics/3d/run_on_separate_thread";
 constexpr char MAX_THREADS[] = "threading/worker_pool/max_threads";
@@ -142,6 +153,8 @@ void JoltProjectSettings::register_settings() {
 	register_setting_plain(EDGE_REMOVAL, true);
 	register_setting_plain(AREAS_DETECT_STATIC, false);
 	register_setting_plain(KINEMATIC_CONTACTS, false);
+	register_setting_plain(CONTACT_IMPULSES, true);
+	register_setting_ranged(BROAD_PHASE_REBUILD, 0, U"0,10000,or_greater");
 
 	register_setting_ranged(SOFT_BODY_POINT_MARGIN, 0.01f, U"0,1,0.001,or_greater,suffix:m");
 
@@ -167,6 +180,15 @@ void JoltProjectSettings::register_settings() {
 	register_setting_ranged(MAX_PAIRS, 65536, U"8,65536,or_greater");
 	register_setting_ranged(MAX_CONTACTS, 20480, U"8,20480,or_greater");
 	register_setting_ranged(MAX_TEMP_MEMORY, 32, U"1,32,or_greater,suffix:MiB");
+	register_setting_ranged(TEMP_MEMORY_SHRINK_DELAY, 60, U"1,600,or_greater");
+
+	register_setting_enum(
+		JOB_SYSTEM,
+		JOB_SYSTEM_WORKER_THREAD_POOL,
+		"Native,Worker Thread Pool",
+		true
+	);
+	register_setting_plain(PARALLEL_SPACES, false, true);
 }
 
 bool JoltProjectSettings::is_sleep_enabled() {
@@ -199,6 +221,16 @@ bool JoltProjectSettings::report_all_kinematic_contacts() {
 	return value;
 }
 
+bool JoltProjectSettings::estimate_contact_impulses() {
+	static const auto value = get_setting<bool>(CONTACT_IMPULSES);
+	return value;
+}
+
+int32_t JoltProjectSettings::get_broad_phase_rebuild_threshold() {
+	static const auto value = get_setting<int32_t>(BROAD_PHASE_REBUILD);
+	return value;
+}
+
 bool JoltProjectSettings::use_enhanced_edge_removal() {
 	static const auto value = get_setting<bool>(EDGE_REMOVAL);
 	return value;
@@ -307,6 +339,21 @@ int64_t JoltProjectSettings::get_max_temp_memory_b() {
 	return value;
 }
 
+int32_t JoltProjectSettings::get_temp_memory_shrink_delay() {
+	static const auto value = get_setting<int32_t>(TEMP_MEMORY_SHRINK_DELAY);
+	return value;
+}
+
+bool JoltProjectSettings::use_native_job_system() {
+	static const auto value = get_setting<int32_t>(JOB_SYSTEM) == JOB_SYSTEM_NATIVE;
+	return value;
+}
+
+bool JoltProjectSettings::should_step_spaces_in_parallel() {
+	static const auto value = get_setting<bool>(PARALLEL_SPACES);
+	return value;
+}
+
 bool JoltProjectSettings::should_run_on_separate_thread() {
 	static const auto value = get_setting<bool>(RUN_ON_SEPARATE_THREAD);
 	return value;
@@ -16,6 +16,10 @@ public:
 
 	static bool report_all_kinematic_contacts();
 
+	static bool estimate_contact_impulses();
+
+	static int32_t get_broad_phase_rebuild_threshold();
+
 	static bool use_enhanced_edge_removal();
 
 	static float get_soft_body_point_margin();
@@ -58,6 +62,12 @@ public:
 
 	static int64_t get_max_temp_memory_b();
 
+	static int32_t get_temp_memory_shrink_delay();
+
+	static bool use_native_job_system();
+
+	static bool should_step_spaces_in_parallel();
+
 	static bool should_run_on_separate_thread();
 
 	static int32_t get_max_threads();
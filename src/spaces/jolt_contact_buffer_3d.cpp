@@ -0,0 +1,68 @@
+#include "jolt_contact_buffer_3d.hpp"
+
+JoltContactBuffer3D::Range JoltContactBuffer3D::find(
+	const JPH::BodyID& p_body_id,
+	int32_t p_max_count
+) const {
+	const auto found = std::lower_bound(
+		body_ranges.begin(),
+		body_ranges.end(),
+		p_body_id,
+		[](const BodyRange& p_range, const JPH::BodyID& p_id) { return p_range.body_id < p_id; }
+	);
+
+	if (found == body_ranges.end() || found->body_id != p_body_id) {
+		return {};
+	}
+
+	return {this, found->offset, MIN(found->count, p_max_count)};
+}
+
+void JoltContactBuffer3D::begin_body(const JPH::BodyID& p_body_id) {
+	if (!body_ranges.is_empty() && body_ranges[body_ranges.size() - 1].body_id == p_body_id) {
+		return;
+	}
+
+	ERR_FAIL_COND_MSG(
+		!body_ranges.is_empty() && p_body_id < body_ranges[body_ranges.size() - 1].body_id,
+		"Contacts must be added in order of body ID."
+	);
+
+	body_ranges.push_back({p_body_id, (int32_t)shape_indices.size(), 0});
+}
+
+int32_t JoltContactBuffer3D::add(int32_t p_count) {
+	ERR_FAIL_COND_V(body_ranges.is_empty(), -1);
+
+	const auto offset = (int32_t)shape_indices.size();
+	const int32_t size = offset + p_count;
+
+	body_ranges[body_ranges.size() - 1].count += p_count;
+
+	shape_indices.resize(size);
+	collider_shape_indices.resize(size);
+	collider_ids.resize(size);
+	collider_rids.resize(size);
+	normals.resize(size);
+	positions.resize(size);
+	collider_positions.resize(size);
+	velocities.resize(size);
+	collider_velocities.resize(size);
+	impulses.resize(size);
+
+	return offset;
+}
+
+void JoltContactBuffer3D::clear() {
+	body_ranges.clear();
+	shape_indices.clear();
+	collider_shape_indices.clear();
+	collider_ids.clear();
+	collider_rids.clear();
+	normals.clear();
+	positions.clear();
+	collider_positions.clear();
+	velocities.clear();
+	collider_velocities.clear();
+	impulses.clear();
+}
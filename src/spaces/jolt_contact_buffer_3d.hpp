@@ -0,0 +1,54 @@
+#pragma once
+
+// Contacts reported during the last step of a space, with each property kept in its own array. The
+// contacts of any one body are stored contiguously, ordered from deepest to shallowest, so that a
+// body's reported contacts are simply the first however many of its range.
+class JoltContactBuffer3D {
+public:
+	struct Range {
+		const JoltContactBuffer3D* buffer = nullptr;
+
+		int32_t offset = 0;
+
+		int32_t count = 0;
+	};
+
+	Range find(const JPH::BodyID& p_body_id, int32_t p_max_count) const;
+
+	void begin_body(const JPH::BodyID& p_body_id);
+
+	int32_t add(int32_t p_count);
+
+	void clear();
+
+	LocalVector<int32_t> shape_indices;
+
+	LocalVector<int32_t> collider_shape_indices;
+
+	LocalVector<ObjectID> collider_ids;
+
+	LocalVector<RID> collider_rids;
+
+	LocalVector<Vector3> normals;
+
+	LocalVector<Vector3> positions;
+
+	LocalVector<Vector3> collider_positions;
+
+	LocalVector<Vector3> velocities;
+
+	LocalVector<Vector3> collider_velocities;
+
+	LocalVector<Vector3> impulses;
+
+private:
+	struct BodyRange {
+		JPH::BodyID body_id;
+
+		int32_t offset = 0;
+
+		int32_t count = 0;
+	};
+
+	LocalVector<BodyRange> body_ranges;
+};
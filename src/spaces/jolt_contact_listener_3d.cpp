@@ -6,8 +6,8 @@
 #include "servers/jolt_project_settings.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
-void JoltContactListener3D::listen_for(JoltShapedObjectImpl3D* p_object) {
-	listening_for.insert(p_object->get_jolt_id());
+void JoltContactListener3D::listen_for(const JPH::BodyID& p_body_id) {
+	listening_for.insert(p_body_id);
 }
 
 void JoltContactListener3D::pre_step() {
@@ -18,9 +18,9 @@ void JoltContactListener3D::pre_step() {
 #endif // GDJ_CONFIG_EDITOR
 }
 
-void JoltContactListener3D::post_step() {
+void JoltContactListener3D::post_step(const LocalVector<JPH::BodyID>& p_shape_changes) {
 	_flush_contacts();
-	_flush_area_shifts();
+	_flush_area_shifts(p_shape_changes);
 	_flush_area_exits();
 	_flush_area_enters();
 }
@@ -84,6 +84,14 @@ void JoltContactListener3D::OnSoftBodyContactAdded(
 
 #endif // GDJ_CONFIG_EDITOR
 
+JoltContactListener3D::Shard& JoltContactListener3D::_get_shard(
+	const JPH::SubShapeIDPair& p_shape_pair
+) {
+	// The lower bits of the hash are what the shard's own containers end up bucketing by, so we use
+	// the upper bits here to not skew their distribution.
+	return shards[ShapePairHasher::hash(p_shape_pair) >> (32 - SHARD_BITS)];
+}
+
 bool JoltContactListener3D::_is_listening_for(const JPH::Body& p_body) const {
 	return listening_for.has(p_body.GetID());
 }
@@ -210,7 +218,10 @@ bool JoltContactListener3D::_try_add_contacts(
 		return false;
 	}
 
-	if (!_is_listening_for(p_body1) && !_is_listening_for(p_body2)) {
+	const bool listening_for1 = _is_listening_for(p_body1);
+	const bool listening_for2 = _is_listening_for(p_body2);
+
+	if (!listening_for1 && !listening_for2) {
 		return false;
 	}
 
@@ -222,33 +233,44 @@ bool JoltContactListener3D::_try_add_contacts(
 	);
 
 	auto& manifold = [&]() -> Manifold& {
-		const MutexLock write_lock(write_mutex);
-		return manifolds_by_shape_pair[shape_pair];
+		Shard& shard = _get_shard(shape_pair);
+		const MutexLock write_lock(shard.mutex);
+		return shard.manifolds_by_shape_pair[shape_pair];
 	}();
 
-	const JPH::uint contact_count = p_manifold.mRelativeContactPointsOn1.size();
+	const auto* body1 = reinterpret_cast<const JoltBodyImpl3D*>(p_body1.GetUserData());
+	const auto* body2 = reinterpret_cast<const JoltBodyImpl3D*>(p_body2.GetUserData());
 
-	manifold.contacts1.reserve((int32_t)contact_count);
-	manifold.contacts2.reserve((int32_t)contact_count);
+	manifold.rid1 = body1->get_rid();
+	manifold.rid2 = body2->get_rid();
+	manifold.instance_id1 = body1->get_instance_id();
+	manifold.instance_id2 = body2->get_instance_id();
+	manifold.shape_index1 = body1->find_shape_index(p_manifold.mSubShapeID1);
+	manifold.shape_index2 = body2->find_shape_index(p_manifold.mSubShapeID2);
 	manifold.depth = p_manifold.mPenetrationDepth;
 
+	const JPH::uint contact_count = p_manifold.mRelativeContactPointsOn1.size();
+
 	JPH::CollisionEstimationResult collision;
 
-	JPH::EstimateCollisionResponse(
-		p_body1,
-		p_body2,
-		p_manifold,
-		collision,
-		p_settings.mCombinedFriction,
-		p_settings.mCombinedRestitution,
-		JoltProjectSettings::get_bounce_velocity_threshold(),
-		5
-	);
+	// Estimating the impulses amounts to solving the contact on its own, which is by far the most
+	// expensive part of reporting contacts, so we let projects that never read them opt out of it.
+	const bool estimate_impulses = JoltProjectSettings::estimate_contact_impulses();
+
+	if (estimate_impulses) {
+		JPH::EstimateCollisionResponse(
+			p_body1,
+			p_body2,
+			p_manifold,
+			collision,
+			p_settings.mCombinedFriction,
+			p_settings.mCombinedRestitution,
+			JoltProjectSettings::get_bounce_velocity_threshold(),
+			5
+		);
+	}
 
 	for (JPH::uint i = 0; i < contact_count; ++i) {
-		Contact& contact1 = manifold.contacts1.emplace_back();
-		Contact& contact2 = manifold.contacts2.emplace_back();
-
 		const auto relative_point1 = JPH::RVec3(p_manifold.mRelativeContactPointsOn1[i]);
 		const auto relative_point2 = JPH::RVec3(p_manifold.mRelativeContactPointsOn2[i]);
 
@@ -258,26 +280,36 @@ bool JoltContactListener3D::_try_add_contacts(
 		const JPH::Vec3 velocity1 = p_body1.GetPointVelocity(world_point1);
 		const JPH::Vec3 velocity2 = p_body2.GetPointVelocity(world_point2);
 
-		const JPH::CollisionEstimationResult::Impulse& impulse = collision.mImpulses[i];
-
-		const JPH::Vec3 contact_impulse = p_manifold.mWorldSpaceNormal * impulse.mContactImpulse;
-		const JPH::Vec3 friction_impulse1 = collision.mTangent1 * impulse.mFrictionImpulse1;
-		const JPH::Vec3 friction_impulse2 = collision.mTangent2 * impulse.mFrictionImpulse2;
-		const JPH::Vec3 combined_impulse = contact_impulse + friction_impulse1 + friction_impulse2;
-
-		contact1.normal = -p_manifold.mWorldSpaceNormal;
-		contact1.point_self = world_point1;
-		contact1.point_other = world_point2;
-		contact1.velocity_self = velocity1;
-		contact1.velocity_other = velocity2;
-		contact1.impulse = -combined_impulse;
-
-		contact2.normal = p_manifold.mWorldSpaceNormal;
-		contact2.point_self = world_point2;
-		contact2.point_other = world_point1;
-		contact2.velocity_self = velocity2;
-		contact2.velocity_other = velocity1;
-		contact2.impulse = combined_impulse;
+		JPH::Vec3 combined_impulse = JPH::Vec3::sZero();
+
+		if (estimate_impulses) {
+			const JPH::CollisionEstimationResult::Impulse& impulse = collision.mImpulses[i];
+
+			const JPH::Vec3 normal_impulse = p_manifold.mWorldSpaceNormal * impulse.mContactImpulse;
+			const JPH::Vec3 friction_impulse1 = collision.mTangent1 * impulse.mFrictionImpulse1;
+			const JPH::Vec3 friction_impulse2 = collision.mTangent2 * impulse.mFrictionImpulse2;
+			combined_impulse = normal_impulse + friction_impulse1 + friction_impulse2;
+		}
+
+		if (listening_for1) {
+			Contact& contact1 = manifold.contacts1.emplace_back();
+			contact1.normal = -p_manifold.mWorldSpaceNormal;
+			contact1.point_self = world_point1;
+			contact1.point_other = world_point2;
+			contact1.velocity_self = velocity1;
+			contact1.velocity_other = velocity2;
+			contact1.impulse = -combined_impulse;
+		}
+
+		if (listening_for2) {
+			Contact& contact2 = manifold.contacts2.emplace_back();
+			contact2.normal = p_manifold.mWorldSpaceNormal;
+			contact2.point_self = world_point2;
+			contact2.point_other = world_point1;
+			contact2.velocity_self = velocity2;
+			contact2.velocity_other = velocity1;
+			contact2.impulse = combined_impulse;
+		}
 	}
 
 	return true;
@@ -293,16 +325,16 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 	}
 
 	auto evaluate = [&](auto&& p_area, auto&& p_object, const JPH::SubShapeIDPair& p_shape_pair) {
-		const MutexLock write_lock(write_mutex);
+		Shard& shard = _get_shard(p_shape_pair);
+		const MutexLock write_lock(shard.mutex);
 
 		if (p_area.can_monitor(p_object)) {
-			if (!area_overlaps.has(p_shape_pair)) {
-				area_overlaps.insert(p_shape_pair);
-				area_enters.insert(p_shape_pair);
+			if (_add_area_overlap(shard, p_shape_pair)) {
+				shard.area_enters.insert(p_shape_pair);
 			}
 		} else {
-			if (area_overlaps.erase(p_shape_pair)) {
-				area_exits.insert(p_shape_pair);
+			if (_erase_area_overlap(shard, p_shape_pair)) {
+				shard.area_exits.insert(p_shape_pair);
 			}
 		}
 	};
@@ -343,9 +375,10 @@ bool JoltContactListener3D::_try_evaluate_area_overlap(
 }
 
 bool JoltContactListener3D::_try_remove_contacts(const JPH::SubShapeIDPair& p_shape_pair) {
-	const MutexLock write_lock(write_mutex);
+	Shard& shard = _get_shard(p_shape_pair);
+	const MutexLock write_lock(shard.mutex);
 
-	return manifolds_by_shape_pair.erase(p_shape_pair);
+	return shard.manifolds_by_shape_pair.erase(p_shape_pair);
 }
 
 bool JoltContactListener3D::_try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair) {
@@ -356,21 +389,63 @@ bool JoltContactListener3D::_try_remove_area_overlap(const JPH::SubShapeIDPair&
 		p_shape_pair.GetSubShapeID1()
 	);
 
-	const MutexLock write_lock(write_mutex);
+	auto try_remove = [&](const JPH::SubShapeIDPair& p_pair) {
+		Shard& shard = _get_shard(p_pair);
+		const MutexLock write_lock(shard.mutex);
 
-	bool removed = false;
+		if (!_erase_area_overlap(shard, p_pair)) {
+			return false;
+		}
 
-	if (area_overlaps.erase(p_shape_pair)) {
-		area_exits.insert(p_shape_pair);
-		removed = true;
+		shard.area_exits.insert(p_pair);
+
+		return true;
+	};
+
+	const bool removed = try_remove(p_shape_pair);
+	const bool removed_swapped = try_remove(swapped_shape_pair);
+
+	return removed || removed_swapped;
+}
+
+bool JoltContactListener3D::_add_area_overlap(
+	Shard& p_shard,
+	const JPH::SubShapeIDPair& p_shape_pair
+) {
+	if (p_shard.area_overlaps.has(p_shape_pair)) {
+		return false;
 	}
 
-	if (area_overlaps.erase(swapped_shape_pair)) {
-		area_exits.insert(swapped_shape_pair);
-		removed = true;
+	p_shard.area_overlaps.insert(p_shape_pair);
+	p_shard.area_overlaps_by_body[p_shape_pair.GetBody1ID()].insert(p_shape_pair);
+	p_shard.area_overlaps_by_body[p_shape_pair.GetBody2ID()].insert(p_shape_pair);
+
+	return true;
+}
+
+bool JoltContactListener3D::_erase_area_overlap(
+	Shard& p_shard,
+	const JPH::SubShapeIDPair& p_shape_pair
+) {
+	if (!p_shard.area_overlaps.erase(p_shape_pair)) {
+		return false;
 	}
 
-	return removed;
+	auto erase_from_body = [&](const JPH::BodyID& p_body_id) {
+		Overlaps* overlaps = p_shard.area_overlaps_by_body.getptr(p_body_id);
+		ERR_FAIL_NULL(overlaps);
+
+		overlaps->erase(p_shape_pair);
+
+		if (overlaps->is_empty()) {
+			p_shard.area_overlaps_by_body.erase(p_body_id);
+		}
+	};
+
+	erase_from_body(p_shape_pair.GetBody1ID());
+	erase_from_body(p_shape_pair.GetBody2ID());
+
+	return true;
 }
 
 #ifdef GDJ_CONFIG_EDITOR
@@ -470,151 +545,191 @@ bool JoltContactListener3D::_try_add_debug_contacts(
 #endif // GDJ_CONFIG_EDITOR
 
 void JoltContactListener3D::_flush_contacts() {
-	for (auto&& [shape_pair, manifold] : manifolds_by_shape_pair) {
-		const JPH::BodyID body_ids[] = {shape_pair.GetBody1ID(), shape_pair.GetBody2ID()};
-
-		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
-
-		JoltBodyImpl3D* body1 = jolt_bodies[0].as_body();
-		ERR_FAIL_NULL(body1);
-
-		JoltBodyImpl3D* body2 = jolt_bodies[1].as_body();
-		ERR_FAIL_NULL(body2);
-
-		const int32_t shape_index1 = body1->find_shape_index(shape_pair.GetSubShapeID1());
-		const int32_t shape_index2 = body2->find_shape_index(shape_pair.GetSubShapeID2());
-
-		for (const Contact& contact : manifold.contacts1) {
-			body1->add_contact(
-				body2,
-				manifold.depth,
-				shape_index1,
-				shape_index2,
-				to_godot(contact.normal),
-				to_godot(contact.point_self),
-				to_godot(contact.point_other),
-				to_godot(contact.velocity_self),
-				to_godot(contact.velocity_other),
-				to_godot(contact.impulse)
-			);
+	reported_contacts.clear();
+	reporting_manifolds.clear();
+
+	for (Shard& shard : shards) {
+		for (auto&& [shape_pair, manifold] : shard.manifolds_by_shape_pair) {
+			if (!manifold.contacts1.is_empty()) {
+				reporting_manifolds.push_back(
+					{shape_pair.GetBody1ID(), &manifold, manifold.depth, false}
+				);
+			}
+
+			if (!manifold.contacts2.is_empty()) {
+				reporting_manifolds.push_back(
+					{shape_pair.GetBody2ID(), &manifold, manifold.depth, true}
+				);
+			}
 		}
+	}
 
-		for (const Contact& contact : manifold.contacts2) {
-			body2->add_contact(
-				body1,
-				manifold.depth,
-				shape_index2,
-				shape_index1,
-				to_godot(contact.normal),
-				to_godot(contact.point_self),
-				to_godot(contact.point_other),
-				to_godot(contact.velocity_self),
-				to_godot(contact.velocity_other),
-				to_godot(contact.impulse)
-			);
+	// Grouping the manifolds by body, from deepest to shallowest, lets us write the contacts of
+	// each body as one contiguous range, with any contacts beyond the body's limit at the end.
+	std::sort(
+		reporting_manifolds.begin(),
+		reporting_manifolds.end(),
+		[](const ReportingManifold& p_lhs, const ReportingManifold& p_rhs) {
+			if (p_lhs.body_id != p_rhs.body_id) {
+				return p_lhs.body_id < p_rhs.body_id;
+			}
+
+			return p_lhs.depth > p_rhs.depth;
+		}
+	);
+
+	for (const ReportingManifold& reporting_manifold : reporting_manifolds) {
+		Manifold& manifold = *reporting_manifold.manifold;
+		const bool is_body2 = reporting_manifold.is_body2;
+
+		Contacts& contacts = is_body2 ? manifold.contacts2 : manifold.contacts1;
+		const int32_t shape_index = is_body2 ? manifold.shape_index2 : manifold.shape_index1;
+		const int32_t collider_shape = is_body2 ? manifold.shape_index1 : manifold.shape_index2;
+		const ObjectID collider_id = is_body2 ? manifold.instance_id1 : manifold.instance_id2;
+		const RID& collider_rid = is_body2 ? manifold.rid1 : manifold.rid2;
+
+		reported_contacts.begin_body(reporting_manifold.body_id);
+
+		const int32_t offset = reported_contacts.add((int32_t)contacts.size());
+		ERR_CONTINUE(offset == -1);
+
+		for (int32_t i = 0; i < (int32_t)contacts.size(); ++i) {
+			const Contact& contact = contacts[i];
+			const int32_t index = offset + i;
+
+			reported_contacts.shape_indices[index] = shape_index;
+			reported_contacts.collider_shape_indices[index] = collider_shape;
+			reported_contacts.collider_ids[index] = collider_id;
+			reported_contacts.collider_rids[index] = collider_rid;
+			reported_contacts.normals[index] = to_godot(contact.normal);
+			reported_contacts.positions[index] = to_godot(contact.point_self);
+			reported_contacts.collider_positions[index] = to_godot(contact.point_other);
+			reported_contacts.velocities[index] = to_godot(contact.velocity_self);
+			reported_contacts.collider_velocities[index] = to_godot(contact.velocity_other);
+			reported_contacts.impulses[index] = to_godot(contact.impulse);
 		}
 
-		manifold.contacts1.clear();
-		manifold.contacts2.clear();
+		contacts.clear();
 	}
+
+	reporting_manifolds.clear();
 }
 
 void JoltContactListener3D::_flush_area_enters() {
-	for (const JPH::SubShapeIDPair& shape_pair : area_enters) {
-		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
-		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
+	for (Shard& shard : shards) {
+		for (const JPH::SubShapeIDPair& shape_pair : shard.area_enters) {
+			const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
+			const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
 
-		const JPH::SubShapeID& sub_shape_id1 = shape_pair.GetSubShapeID1();
-		const JPH::SubShapeID& sub_shape_id2 = shape_pair.GetSubShapeID2();
+			const JPH::SubShapeID& sub_shape_id1 = shape_pair.GetSubShapeID1();
+			const JPH::SubShapeID& sub_shape_id2 = shape_pair.GetSubShapeID2();
 
-		const JPH::BodyID body_ids[] = {body_id1, body_id2};
+			const JPH::BodyID body_ids[] = {body_id1, body_id2};
 
-		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
+			const JoltReadableBodies3D jolt_bodies = space->read_bodies(
+				body_ids,
+				count_of(body_ids)
+			);
 
-		const JoltReadableBody3D jolt_body1 = jolt_bodies[0];
-		const JoltReadableBody3D jolt_body2 = jolt_bodies[1];
+			const JoltReadableBody3D jolt_body1 = jolt_bodies[0];
+			const JoltReadableBody3D jolt_body2 = jolt_bodies[1];
 
-		if (jolt_body1.is_invalid() || jolt_body2.is_invalid()) {
-			continue;
-		}
+			if (jolt_body1.is_invalid() || jolt_body2.is_invalid()) {
+				continue;
+			}
 
-		JoltAreaImpl3D* area1 = jolt_body1.as_area();
-		JoltAreaImpl3D* area2 = jolt_body2.as_area();
+			JoltAreaImpl3D* area1 = jolt_body1.as_area();
+			JoltAreaImpl3D* area2 = jolt_body2.as_area();
 
-		if (area1 != nullptr && area2 != nullptr) {
-			area1->area_shape_entered(body_id2, sub_shape_id2, sub_shape_id1);
-		} else if (area1 != nullptr && area2 == nullptr) {
-			area1->body_shape_entered(body_id2, sub_shape_id2, sub_shape_id1);
-		} else if (area1 == nullptr && area2 != nullptr) {
-			area2->body_shape_entered(body_id1, sub_shape_id1, sub_shape_id2);
+			if (area1 != nullptr && area2 != nullptr) {
+				area1->area_shape_entered(body_id2, sub_shape_id2, sub_shape_id1);
+			} else if (area1 != nullptr && area2 == nullptr) {
+				area1->body_shape_entered(body_id2, sub_shape_id2, sub_shape_id1);
+			} else if (area1 == nullptr && area2 != nullptr) {
+				area2->body_shape_entered(body_id1, sub_shape_id1, sub_shape_id2);
+			}
 		}
-	}
 
-	area_enters.clear();
+		shard.area_enters.clear();
+	}
 }
 
-void JoltContactListener3D::_flush_area_shifts() {
-	for (const JPH::SubShapeIDPair& shape_pair : area_overlaps) {
-		auto is_shifted = [&](const JPH::BodyID& p_body_id, const JPH::SubShapeID& p_sub_shape_id) {
-			const JoltReadableBody3D jolt_body = space->read_body(p_body_id);
-			const JoltShapedObjectImpl3D* object = jolt_body.as_shaped();
-			ERR_FAIL_NULL_V(object, false);
+void JoltContactListener3D::_flush_area_shifts(const LocalVector<JPH::BodyID>& p_shape_changes) {
+	// Shapes only shift around when an object's shape is rebuilt, so rather than checking every
+	// overlap in the space we only look at the overlaps of the objects that were rebuilt.
+	for (const JPH::BodyID& body_id : p_shape_changes) {
+		const JoltReadableBody3D jolt_body = space->read_body(body_id);
+		const JoltShapedObjectImpl3D* object = jolt_body.as_shaped();
 
-			if (object->get_previous_jolt_shape() == nullptr) {
-				return false;
-			}
+		if (object == nullptr || object->get_previous_jolt_shape() == nullptr) {
+			continue;
+		}
+
+		const JPH::Shape& current_shape = *object->get_jolt_shape();
+		const JPH::Shape& previous_shape = *object->get_previous_jolt_shape();
+
+		for (Shard& shard : shards) {
+			const Overlaps* overlaps = shard.area_overlaps_by_body.getptr(body_id);
 
-			const JPH::Shape& current_shape = *object->get_jolt_shape();
-			const JPH::Shape& previous_shape = *object->get_previous_jolt_shape();
+			if (overlaps == nullptr) {
+				continue;
+			}
 
-			const auto current_id = (uint32_t)current_shape.GetSubShapeUserData(p_sub_shape_id);
-			const auto previous_id = (uint32_t)previous_shape.GetSubShapeUserData(p_sub_shape_id);
+			for (const JPH::SubShapeIDPair& shape_pair : *overlaps) {
+				const JPH::SubShapeID& sub_shape_id = shape_pair.GetBody1ID() == body_id
+					? shape_pair.GetSubShapeID1()
+					: shape_pair.GetSubShapeID2();
 
-			return current_id != previous_id;
-		};
+				const auto current_id = (uint32_t)current_shape.GetSubShapeUserData(sub_shape_id);
+				const auto previous_id = (uint32_t)previous_shape.GetSubShapeUserData(sub_shape_id);
 
-		if (is_shifted(shape_pair.GetBody1ID(), shape_pair.GetSubShapeID1()) ||
-			is_shifted(shape_pair.GetBody2ID(), shape_pair.GetSubShapeID2()))
-		{
-			area_enters.insert(shape_pair);
-			area_exits.insert(shape_pair);
+				if (current_id != previous_id) {
+					shard.area_enters.insert(shape_pair);
+					shard.area_exits.insert(shape_pair);
+				}
+			}
 		}
 	}
 }
 
 void JoltContactListener3D::_flush_area_exits() {
-	for (const JPH::SubShapeIDPair& shape_pair : area_exits) {
-		const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
-		const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
-
-		const JPH::SubShapeID& sub_shape_id1 = shape_pair.GetSubShapeID1();
-		const JPH::SubShapeID& sub_shape_id2 = shape_pair.GetSubShapeID2();
-
-		const JPH::BodyID body_ids[] = {body_id1, body_id2};
-
-		const JoltReadableBodies3D jolt_bodies = space->read_bodies(body_ids, count_of(body_ids));
+	for (Shard& shard : shards) {
+		for (const JPH::SubShapeIDPair& shape_pair : shard.area_exits) {
+			const JPH::BodyID& body_id1 = shape_pair.GetBody1ID();
+			const JPH::BodyID& body_id2 = shape_pair.GetBody2ID();
 
-		const JoltReadableBody3D jolt_body1 = jolt_bodies[0];
-		const JoltReadableBody3D jolt_body2 = jolt_bodies[1];
+			const JPH::SubShapeID& sub_shape_id1 = shape_pair.GetSubShapeID1();
+			const JPH::SubShapeID& sub_shape_id2 = shape_pair.GetSubShapeID2();
 
-		JoltAreaImpl3D* area1 = jolt_body1.as_area();
-		JoltAreaImpl3D* area2 = jolt_body2.as_area();
+			const JPH::BodyID body_ids[] = {body_id1, body_id2};
 
-		const JoltBodyImpl3D* body1 = jolt_body1.as_body();
-		const JoltBodyImpl3D* body2 = jolt_body2.as_body();
+			const JoltReadableBodies3D jolt_bodies = space->read_bodies(
+				body_ids,
+				count_of(body_ids)
+			);
 
-		if (area1 != nullptr && area2 != nullptr) {
-			area1->area_shape_exited(body_id2, sub_shape_id2, sub_shape_id1);
-		} else if (area1 != nullptr && body2 != nullptr) {
-			area1->body_shape_exited(body_id2, sub_shape_id2, sub_shape_id1);
-		} else if (body1 != nullptr && area2 != nullptr) {
-			area2->body_shape_exited(body_id1, sub_shape_id1, sub_shape_id2);
-		} else if (area1 != nullptr) {
-			area1->shape_exited(body_id2, sub_shape_id2, sub_shape_id1);
-		} else if (area2 != nullptr) {
-			area2->shape_exited(body_id1, sub_shape_id1, sub_shape_id2);
+			const JoltReadableBody3D jolt_body1 = jolt_bodies[0];
+			const JoltReadableBody3D jolt_body2 = jolt_bodies[1];
+
+			JoltAreaImpl3D* area1 = jolt_body1.as_area();
+			JoltAreaImpl3D* area2 = jolt_body2.as_area();
+
+			const JoltBodyImpl3D* body1 = jolt_body1.as_body();
+			const JoltBodyImpl3D* body2 = jolt_body2.as_body();
+
+			if (area1 != nullptr && area2 != nullptr) {
+				area1->area_shape_exited(body_id2, sub_shape_id2, sub_shape_id1);
+			} else if (area1 != nullptr && body2 != nullptr) {
+				area1->body_shape_exited(body_id2, sub_shape_id2, sub_shape_id1);
+			} else if (body1 != nullptr && area2 != nullptr) {
+				area2->body_shape_exited(body_id1, sub_shape_id1, sub_shape_id2);
+			} else if (area1 != nullptr) {
+				area1->shape_exited(body_id2, sub_shape_id2, sub_shape_id1);
+			} else if (area2 != nullptr) {
+				area2->shape_exited(body_id1, sub_shape_id1, sub_shape_id2);
+			}
 		}
-	}
 
-	area_exits.clear();
+		shard.area_exits.clear();
+	}
 }
@@ -1,6 +1,7 @@
 #pragma once
 
-class JoltShapedObjectImpl3D;
+#include "spaces/jolt_contact_buffer_3d.hpp"
+
 class JoltSpace3D;
 
 class JoltContactListener3D final
@@ -42,29 +43,78 @@ class JoltContactListener3D final
 
 	using Contacts = LocalVector<Contact>;
 
+	// Everything about the two bodies that gets reported alongside their contacts is resolved
+	// once per manifold, while we still have access to the bodies, rather than once per contact.
 	struct Manifold {
 		Contacts contacts1;
 
 		Contacts contacts2;
 
+		RID rid1;
+
+		RID rid2;
+
+		ObjectID instance_id1;
+
+		ObjectID instance_id2;
+
+		int32_t shape_index1 = -1;
+
+		int32_t shape_index2 = -1;
+
 		float depth = 0.0f;
 	};
 
+	struct ReportingManifold {
+		JPH::BodyID body_id;
+
+		Manifold* manifold = nullptr;
+
+		float depth = 0.0f;
+
+		bool is_body2 = false;
+	};
+
 	using BodyIDs = HashSet<JPH::BodyID, BodyIDHasher>;
 
 	using Overlaps = HashSet<JPH::SubShapeIDPair, ShapePairHasher>;
 
+	using OverlapsByBody = HashMap<JPH::BodyID, Overlaps, BodyIDHasher>;
+
 	using ManifoldsByShapePair = HashMap<JPH::SubShapeIDPair, Manifold, ShapePairHasher>;
 
+	// Contact callbacks are invoked concurrently from Jolt's contact jobs, so rather than funneling
+	// them all through a single mutex we spread the shape pairs across a number of shards, each with
+	// its own mutex, meaning callbacks only ever contend when their pairs share a shard.
+	static constexpr int32_t SHARD_BITS = 6;
+
+	static constexpr int32_t SHARD_COUNT = 1 << SHARD_BITS;
+
+	struct alignas(64) Shard {
+		ManifoldsByShapePair manifolds_by_shape_pair;
+
+		Overlaps area_overlaps;
+
+		OverlapsByBody area_overlaps_by_body;
+
+		Overlaps area_enters;
+
+		Overlaps area_exits;
+
+		Mutex mutex;
+	};
+
 public:
 	explicit JoltContactListener3D(JoltSpace3D* p_space)
 		: space(p_space) { }
 
-	void listen_for(JoltShapedObjectImpl3D* p_object);
+	void listen_for(const JPH::BodyID& p_body_id);
 
 	void pre_step();
 
-	void post_step();
+	void post_step(const LocalVector<JPH::BodyID>& p_shape_changes);
+
+	const JoltContactBuffer3D& get_reported_contacts() const { return reported_contacts; }
 
 #ifdef GDJ_CONFIG_EDITOR
 	const PackedVector3Array& get_debug_contacts() const { return debug_contacts; }
@@ -106,6 +156,8 @@ private:
 	) override;
 #endif // GDJ_CONFIG_EDITOR
 
+	Shard& _get_shard(const JPH::SubShapeIDPair& p_shape_pair);
+
 	bool _is_listening_for(const JPH::Body& p_body) const;
 
 	bool _try_override_collision_response(
@@ -143,6 +195,10 @@ private:
 
 	bool _try_remove_area_overlap(const JPH::SubShapeIDPair& p_shape_pair);
 
+	bool _add_area_overlap(Shard& p_shard, const JPH::SubShapeIDPair& p_shape_pair);
+
+	bool _erase_area_overlap(Shard& p_shard, const JPH::SubShapeIDPair& p_shape_pair);
+
 #ifdef GDJ_CONFIG_EDITOR
 	bool _try_add_debug_contacts(
 		const JPH::Body& p_body1,
@@ -160,21 +216,17 @@ private:
 
 	void _flush_area_enters();
 
-	void _flush_area_shifts();
+	void _flush_area_shifts(const LocalVector<JPH::BodyID>& p_shape_changes);
 
 	void _flush_area_exits();
 
-	ManifoldsByShapePair manifolds_by_shape_pair;
+	Shard shards[SHARD_COUNT];
 
 	BodyIDs listening_for;
 
-	Overlaps area_overlaps;
-
-	Overlaps area_enters;
-
-	Overlaps area_exits;
+	LocalVector<ReportingManifold> reporting_manifolds;
 
-	Mutex write_mutex;
+	JoltContactBuffer3D reported_contacts;
 
 	JoltSpace3D* space = nullptr;
 
@@ -2,18 +2,45 @@
 
 #include "servers/jolt_project_settings.hpp"
 
-JoltJobSystem::JoltJobSystem()
-	: JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers)
-	, jobs(JPH::cMaxPhysicsJobs) {
+namespace {
+
+int32_t calculate_thread_count() {
 	const int32_t max_threads = JoltProjectSettings::get_max_threads();
 
 	if (max_threads != -1) {
-		thread_count = max_threads;
+		return max_threads;
+	} else {
+		return OS::get_singleton()->get_processor_count();
+	}
+}
+
+int32_t calculate_max_concurrent_steps() {
+	// When stepping spaces in parallel we can end up with one `PhysicsSystem::Update`
+	// per worker thread, each of which can use up to `cMaxPhysicsJobs` jobs and
+	// `cMaxPhysicsBarriers` barriers, so we need to size things accordingly.
+	if (JoltProjectSettings::should_step_spaces_in_parallel()) {
+		return MAX(calculate_thread_count(), 1);
 	} else {
-		thread_count = OS::get_singleton()->get_processor_count();
+		return 1;
 	}
 }
 
+} // namespace
+
+JoltJobSystem::JoltJobSystem()
+	: JPH::JobSystemWithBarrier(JPH::cMaxPhysicsBarriers * calculate_max_concurrent_steps())
+	, jobs(JPH::cMaxPhysicsJobs * calculate_max_concurrent_steps())
+	, thread_count(calculate_thread_count())
+	, use_native_scheduler(JoltProjectSettings::use_native_job_system()) {
+	if (use_native_scheduler) {
+		_start_workers();
+	}
+}
+
+JoltJobSystem::~JoltJobSystem() {
+	_stop_workers();
+}
+
 void JoltJobSystem::pre_step() {
 	// Nothing to do
 }
@@ -103,25 +130,88 @@ void JoltJobSystem::Job::queue() {
 	task_id = WorkerThreadPool::get_singleton()->add_native_task(&_execute, this, true, task_name);
 }
 
-void JoltJobSystem::Job::_execute(void* p_user_data) {
-	auto* job = static_cast<Job*>(p_user_data);
-
+void JoltJobSystem::Job::execute() {
 #ifdef GDJ_CONFIG_EDITOR
 	const uint64_t time_start = Time::get_singleton()->get_ticks_usec();
 #endif // GDJ_CONFIG_EDITOR
 
-	job->Execute();
+	Execute();
 
 #ifdef GDJ_CONFIG_EDITOR
 	const uint64_t time_end = Time::get_singleton()->get_ticks_usec();
 	const uint64_t time_elapsed = time_end - time_start;
 
 	timings_lock.lock();
-	timings_by_job[job->name] += time_elapsed;
+	timings_by_job[name] += time_elapsed;
 	timings_lock.unlock();
 #endif // GDJ_CONFIG_EDITOR
 
-	job->Release();
+	Release();
+}
+
+void JoltJobSystem::Job::_execute(void* p_user_data) {
+	static_cast<Job*>(p_user_data)->execute();
+}
+
+bool JoltJobSystem::JobQueue::push(Job* p_job) {
+	const int64_t b = bottom.load(std::memory_order_relaxed);
+	const int64_t t = top.load(std::memory_order_acquire);
+
+	if (b - t >= CAPACITY) {
+		return false;
+	}
+
+	buffer[b & (CAPACITY - 1)].store(p_job, std::memory_order_relaxed);
+	bottom.store(b + 1, std::memory_order_release);
+
+	return true;
+}
+
+JoltJobSystem::Job* JoltJobSystem::JobQueue::pop() {
+	const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+	bottom.store(b, std::memory_order_relaxed);
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	int64_t t = top.load(std::memory_order_relaxed);
+
+	if (t > b) {
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	Job* job = buffer[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+
+	if (t == b) {
+		// This was the last job, so we need to race any thieves for it
+		if (!top.compare_exchange_strong(t, t + 1)) {
+			job = nullptr;
+		}
+
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+
+	return job;
+}
+
+JoltJobSystem::Job* JoltJobSystem::JobQueue::steal() {
+	int64_t t = top.load(std::memory_order_acquire);
+
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+
+	const int64_t b = bottom.load(std::memory_order_acquire);
+
+	if (t >= b) {
+		return nullptr;
+	}
+
+	Job* job = buffer[t & (CAPACITY - 1)].load(std::memory_order_relaxed);
+
+	if (!top.compare_exchange_strong(t, t + 1)) {
+		return nullptr;
+	}
+
+	return job;
 }
 
 int JoltJobSystem::GetMaxConcurrency() const {
@@ -164,7 +254,14 @@ JPH::JobHandle JoltJobSystem::CreateJob(
 }
 
 void JoltJobSystem::QueueJob(JPH::JobSystem::Job* p_job) {
-	static_cast<Job*>(p_job)->queue();
+	auto* job = static_cast<Job*>(p_job);
+
+	if (use_native_scheduler) {
+		job->AddRef();
+		_push_job(job);
+	} else {
+		job->queue();
+	}
 }
 
 void JoltJobSystem::QueueJobs(JPH::JobSystem::Job** p_jobs, JPH::uint p_job_count) {
@@ -182,3 +279,99 @@ void JoltJobSystem::_reclaim_jobs() {
 		jobs.destruct(job);
 	}
 }
+
+void JoltJobSystem::_start_workers() {
+	// The thread that calls `PhysicsSystem::Update` also executes jobs while it waits on its
+	// barrier, so we leave room for it here.
+	const int32_t worker_count = MAX(thread_count - 1, 1);
+
+	worker_queues.reserve(worker_count);
+
+	for (int32_t i = 0; i < worker_count; ++i) {
+		worker_queues.push_back(new JobQueue());
+	}
+
+	workers.reserve(worker_count);
+
+	for (int32_t i = 0; i < worker_count; ++i) {
+		workers.emplace_back(&JoltJobSystem::_worker_main, this, i);
+	}
+}
+
+void JoltJobSystem::_stop_workers() {
+	if (workers.is_empty()) {
+		return;
+	}
+
+	stopping = true;
+
+	jobs_available.Release((JPH::uint)workers.size());
+
+	for (std::thread& worker : workers) {
+		worker.join();
+	}
+
+	workers.clear();
+
+	for (JobQueue*& worker_queue : worker_queues) {
+		delete_safely(worker_queue);
+	}
+
+	worker_queues.clear();
+}
+
+void JoltJobSystem::_worker_main(int32_t p_index) {
+	worker_index = p_index;
+
+	while (true) {
+		jobs_available.Acquire();
+
+		if (stopping) {
+			break;
+		}
+
+		while (Job* job = _pop_job(p_index)) {
+			job->execute();
+		}
+	}
+
+	worker_index = -1;
+}
+
+void JoltJobSystem::_push_job(Job* p_job) {
+	const bool pushed = worker_index != -1 && worker_queues[worker_index]->push(p_job);
+
+	if (!pushed) {
+		const std::unique_lock lock(injected_jobs_mutex);
+		injected_jobs.push_back(p_job);
+	}
+
+	jobs_available.Release();
+}
+
+JoltJobSystem::Job* JoltJobSystem::_pop_job(int32_t p_index) {
+	if (Job* job = worker_queues[p_index]->pop()) {
+		return job;
+	}
+
+	{
+		const std::unique_lock lock(injected_jobs_mutex);
+
+		if (!injected_jobs.is_empty()) {
+			const int32_t last_index = injected_jobs.size() - 1;
+			Job* job = injected_jobs[last_index];
+			injected_jobs.remove_at(last_index);
+			return job;
+		}
+	}
+
+	const int32_t queue_count = worker_queues.size();
+
+	for (int32_t i = 1; i < queue_count; ++i) {
+		if (Job* job = worker_queues[(p_index + i) % queue_count]->steal()) {
+			return job;
+		}
+	}
+
+	return nullptr;
+}
@@ -4,6 +4,8 @@ class JoltJobSystem final : public JPH::JobSystemWithBarrier {
 public:
 	JoltJobSystem();
 
+	~JoltJobSystem() override;
+
 	void pre_step();
 
 	void post_step();
@@ -33,6 +35,8 @@ private:
 
 		void queue();
 
+		void execute();
+
 		Job& operator=(const Job& p_other) = delete;
 
 		Job& operator=(Job&& p_other) = delete;
@@ -51,6 +55,28 @@ private:
 		std::atomic<Job*> completed_next = nullptr;
 	};
 
+	// Fixed-capacity work-stealing deque, where the owning worker pushes and pops at the bottom and
+	// any other thread steals from the top, as described by Chase and Lev.
+	class JobQueue {
+	public:
+		static constexpr int64_t CAPACITY = JPH::cMaxPhysicsJobs;
+
+		static_assert(is_power_of_2(CAPACITY));
+
+		bool push(Job* p_job);
+
+		Job* pop();
+
+		Job* steal();
+
+	private:
+		alignas(64) std::atomic<int64_t> top = 0;
+
+		alignas(64) std::atomic<int64_t> bottom = 0;
+
+		std::atomic<Job*> buffer[CAPACITY] = {};
+	};
+
 	int GetMaxConcurrency() const override;
 
 	JPH::JobHandle CreateJob(
@@ -68,6 +94,16 @@ private:
 
 	void _reclaim_jobs();
 
+	void _start_workers();
+
+	void _stop_workers();
+
+	void _worker_main(int32_t p_index);
+
+	void _push_job(Job* p_job);
+
+	Job* _pop_job(int32_t p_index);
+
 #ifdef GDJ_CONFIG_EDITOR
 	// HACK(mihe): We use `const void*` here to avoid the cost of hashing the actual string, since
 	// the job names are always literals and as such will point to the same address every time.
@@ -76,7 +112,23 @@ private:
 	inline static SpinLock timings_lock;
 #endif // GDJ_CONFIG_EDITOR
 
+	inline static thread_local int32_t worker_index = -1;
+
 	FreeList<Job> jobs;
 
+	LocalVector<std::thread> workers;
+
+	LocalVector<JobQueue*> worker_queues;
+
+	LocalVector<Job*> injected_jobs;
+
+	std::mutex injected_jobs_mutex;
+
+	JPH::Semaphore jobs_available;
+
+	std::atomic<bool> stopping = false;
+
 	int32_t thread_count = 0;
+
+	bool use_native_scheduler = false;
 };
@@ -5,6 +5,10 @@
 
 namespace {
 
+constexpr uint16_t OBJECT_LAYER_COUNT = 1U << 13U;
+
+constexpr int32_t INITIAL_OBJECT_LAYER_CAPACITY = 32;
+
 template<uint8_t TSize = JoltBroadPhaseLayer::COUNT>
 class JoltBroadPhaseMatrix {
 	using LayerType = JPH::BroadPhaseLayer;
@@ -89,10 +93,41 @@ constexpr void decode_collision(
 	p_collision_mask = uint32_t(p_collision & 0xFFFFFFFFU);
 }
 
+constexpr bool collisions_overlap(uint64_t p_collision1, uint64_t p_collision2) {
+	uint32_t collision_layer1 = 0;
+	uint32_t collision_mask1 = 0;
+	decode_collision(p_collision1, collision_layer1, collision_mask1);
+
+	uint32_t collision_layer2 = 0;
+	uint32_t collision_mask2 = 0;
+	decode_collision(p_collision2, collision_layer2, collision_mask2);
+
+	const bool first_scans_second = (collision_mask1 & collision_layer2) != 0;
+	const bool second_scans_first = (collision_mask2 & collision_layer1) != 0;
+
+	return first_scans_second || second_scans_first;
+}
+
 } // namespace
 
-JoltLayerMapper::JoltLayerMapper() {
-	_allocate_object_layer(0);
+JoltLayerMapper::CollisionTable::CollisionTable(int32_t p_capacity)
+	: pairs(p_capacity) {
+	collisions_by_layer.resize(p_capacity);
+}
+
+JoltLayerMapper::JoltLayerMapper()
+	: collision_table(new CollisionTable(INITIAL_OBJECT_LAYER_CAPACITY)) {
+	// The empty collision is what every object starts out with, so we make sure it's never released
+	const JPH::ObjectLayer default_object_layer = _allocate_object_layer(0);
+	ref_counts_by_layer[default_object_layer] = 1;
+}
+
+JoltLayerMapper::~JoltLayerMapper() {
+	delete collision_table.load(std::memory_order_relaxed);
+
+	for (CollisionTable* retired_collision_table : retired_collision_tables) {
+		delete retired_collision_table;
+	}
 }
 
 JPH::ObjectLayer JoltLayerMapper::to_object_layer(
@@ -108,26 +143,45 @@ JPH::ObjectLayer JoltLayerMapper::to_object_layer(
 	if (iter != layers_by_collision.end()) {
 		object_layer = iter->second;
 	} else {
-		constexpr uint16_t object_layer_count = 1U << 13U;
-
 		ERR_FAIL_COND_D_MSG(
-			next_object_layer == object_layer_count,
+			next_object_layer == OBJECT_LAYER_COUNT && free_object_layers.is_empty(),
 			vformat(
 				"Maximum number of object layers (%d) reached. "
-				"This means there are %d combinations of collision layers and masks. "
+				"This means there are %d combinations of collision layers and masks in use. "
 				"This should not happen under normal circumstances. "
 				"Consider reporting this issue.",
-				object_layer_count,
-				object_layer_count
+				OBJECT_LAYER_COUNT,
+				OBJECT_LAYER_COUNT
 			)
 		);
 
 		object_layer = _allocate_object_layer(collision);
 	}
 
+	ref_counts_by_layer[object_layer] += 1;
+
 	return encode_layers(p_broad_phase_layer, object_layer);
 }
 
+void JoltLayerMapper::release_object_layer(JPH::ObjectLayer p_encoded_layer) {
+	JPH::BroadPhaseLayer broad_phase_layer = {};
+	JPH::ObjectLayer object_layer = 0;
+	decode_layers(p_encoded_layer, broad_phase_layer, object_layer);
+
+	ERR_FAIL_INDEX(object_layer, next_object_layer);
+	ERR_FAIL_COND(ref_counts_by_layer[object_layer] == 0);
+
+	if (--ref_counts_by_layer[object_layer] > 0) {
+		return;
+	}
+
+	const CollisionTable* table = collision_table.load(std::memory_order_relaxed);
+
+	layers_by_collision.erase(table->collisions_by_layer[object_layer]);
+
+	free_object_layers.push_back(object_layer);
+}
+
 void JoltLayerMapper::from_object_layer(
 	JPH::ObjectLayer p_encoded_layer,
 	JPH::BroadPhaseLayer& p_broad_phase_layer,
@@ -137,7 +191,9 @@ void JoltLayerMapper::from_object_layer(
 	JPH::ObjectLayer object_layer = {};
 	decode_layers(p_encoded_layer, p_broad_phase_layer, object_layer);
 
-	const uint64_t collision = collisions_by_layer[object_layer];
+	const CollisionTable* table = collision_table.load(std::memory_order_acquire);
+
+	const uint64_t collision = table->collisions_by_layer[object_layer];
 
 	decode_collision(collision, p_collision_layer, p_collision_mask);
 }
@@ -183,19 +239,16 @@ bool JoltLayerMapper::ShouldCollide(
 	JPH::ObjectLayer p_encoded_layer2
 ) const {
 	JPH::BroadPhaseLayer broad_phase_layer1 = {};
-	uint32_t collision_layer1 = 0;
-	uint32_t collision_mask1 = 0;
-	from_object_layer(p_encoded_layer1, broad_phase_layer1, collision_layer1, collision_mask1);
+	JPH::ObjectLayer object_layer1 = 0;
+	decode_layers(p_encoded_layer1, broad_phase_layer1, object_layer1);
 
 	JPH::BroadPhaseLayer broad_phase_layer2 = {};
-	uint32_t collision_layer2 = 0;
-	uint32_t collision_mask2 = 0;
-	from_object_layer(p_encoded_layer2, broad_phase_layer2, collision_layer2, collision_mask2);
+	JPH::ObjectLayer object_layer2 = 0;
+	decode_layers(p_encoded_layer2, broad_phase_layer2, object_layer2);
 
-	const bool first_scans_second = (collision_mask1 & collision_layer2) != 0;
-	const bool second_scans_first = (collision_mask2 & collision_layer1) != 0;
+	const CollisionTable* table = collision_table.load(std::memory_order_acquire);
 
-	return first_scans_second || second_scans_first;
+	return table->pairs.has(object_layer1, object_layer2);
 }
 
 bool JoltLayerMapper::ShouldCollide(
@@ -212,15 +265,83 @@ bool JoltLayerMapper::ShouldCollide(
 }
 
 JPH::ObjectLayer JoltLayerMapper::_allocate_object_layer(uint64_t p_collision) {
-	const JPH::ObjectLayer new_object_layer = next_object_layer++;
+	JPH::ObjectLayer new_object_layer = 0;
+
+	if (!free_object_layers.is_empty()) {
+		const int32_t last_index = free_object_layers.size() - 1;
+		new_object_layer = free_object_layers[last_index];
+		free_object_layers.remove_at(last_index);
+	} else {
+		new_object_layer = next_object_layer++;
+
+		ref_counts_by_layer.resize(new_object_layer + 1);
+
+		_reserve_collision_table(new_object_layer + 1);
+	}
+
+	CollisionTable* table = collision_table.load(std::memory_order_relaxed);
 
-	collisions_by_layer.resize(new_object_layer + 1);
-	collisions_by_layer[new_object_layer] = p_collision;
+	table->collisions_by_layer[new_object_layer] = p_collision;
+	ref_counts_by_layer[new_object_layer] = 0;
 
 	layers_by_collision[p_collision] = new_object_layer;
 
+	_update_collision_pairs(*table, new_object_layer);
+
 	return new_object_layer;
 }
 
+void JoltLayerMapper::_reserve_collision_table(int32_t p_count) {
+	CollisionTable* old_table = collision_table.load(std::memory_order_relaxed);
+
+	const int32_t old_capacity = old_table->pairs.get_size();
+	int32_t new_capacity = old_capacity;
+
+	if (p_count <= new_capacity) {
+		return;
+	}
+
+	while (new_capacity < p_count) {
+		new_capacity *= 2;
+	}
+
+	auto* new_table = new CollisionTable(MIN(new_capacity, (int32_t)OBJECT_LAYER_COUNT));
+
+	for (int32_t i = 0; i < old_capacity; ++i) {
+		new_table->collisions_by_layer[i] = old_table->collisions_by_layer[i];
+	}
+
+	for (JPH::ObjectLayer i = 0; i < next_object_layer; ++i) {
+		if (ref_counts_by_layer[i] > 0) {
+			_update_collision_pairs(*new_table, i);
+		}
+	}
+
+	retired_collision_tables.push_back(old_table);
+
+	collision_table.store(new_table, std::memory_order_release);
+}
+
+void JoltLayerMapper::_update_collision_pairs(
+	CollisionTable& p_table,
+	JPH::ObjectLayer p_object_layer
+) const {
+	// Layers that are no longer in use are left as they are, since nothing will be asking about
+	// them until they're allocated again, at which point they get updated here
+	const uint64_t collision = p_table.collisions_by_layer[p_object_layer];
+
+	for (JPH::ObjectLayer i = 0; i < next_object_layer; ++i) {
+		if (i != p_object_layer && ref_counts_by_layer[i] == 0) {
+			continue;
+		}
+
+		if (collisions_overlap(collision, p_table.collisions_by_layer[i])) {
+			p_table.pairs.set(p_object_layer, i);
+		} else {
+			p_table.pairs.unset(p_object_layer, i);
+		}
+	}
+}
+
 static_assert(sizeof(JPH::ObjectLayer) == 2);
 static_assert(sizeof(JPH::BroadPhaseLayer::Type) == 1);
@@ -7,12 +7,24 @@ class JoltLayerMapper final
 public:
 	JoltLayerMapper();
 
+	JoltLayerMapper(const JoltLayerMapper& p_other) = delete;
+
+	JoltLayerMapper(JoltLayerMapper&& p_other) = delete;
+
+	~JoltLayerMapper() override;
+
+	JoltLayerMapper& operator=(const JoltLayerMapper& p_other) = delete;
+
+	JoltLayerMapper& operator=(JoltLayerMapper&& p_other) = delete;
+
 	JPH::ObjectLayer to_object_layer(
 		JPH::BroadPhaseLayer p_broad_phase_layer,
 		uint32_t p_collision_layer,
 		uint32_t p_collision_mask
 	);
 
+	void release_object_layer(JPH::ObjectLayer p_encoded_layer);
+
 	void from_object_layer(
 		JPH::ObjectLayer p_encoded_layer,
 		JPH::BroadPhaseLayer& p_broad_phase_layer,
@@ -21,6 +33,18 @@ public:
 	) const;
 
 private:
+	// Everything that gets read when filtering collisions, which queries can be doing from other
+	// threads while objects are being added or changed, so rather than growing this in place we
+	// replace it with a bigger one. Entries are only ever modified in place for layers that are
+	// being allocated, which nothing will be asking about until they're handed out.
+	struct CollisionTable {
+		explicit CollisionTable(int32_t p_capacity);
+
+		SymmetricBitTable pairs;
+
+		LocalVector<uint64_t> collisions_by_layer;
+	};
+
 	uint32_t GetNumBroadPhaseLayers() const override;
 
 	JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer p_layer) const override;
@@ -37,9 +61,22 @@ private:
 
 	JPH::ObjectLayer _allocate_object_layer(uint64_t p_collision);
 
-	InlineVector<uint64_t, 32> collisions_by_layer;
+	void _reserve_collision_table(int32_t p_count);
+
+	void _update_collision_pairs(CollisionTable& p_table, JPH::ObjectLayer p_object_layer) const;
+
+	InlineVector<uint32_t, 32> ref_counts_by_layer;
+
+	LocalVector<JPH::ObjectLayer> free_object_layers;
 
 	HashMap<uint64_t, JPH::ObjectLayer> layers_by_collision;
 
+	std::atomic<CollisionTable*> collision_table = nullptr;
+
+	// Tables that have been replaced might still be in use by queries that were already running,
+	// so we hold on to them until we're destroyed, which since the table doubles in size each time
+	// never adds up to more than the size of the current one
+	LocalVector<CollisionTable*> retired_collision_tables;
+
 	JPH::ObjectLayer next_object_layer = 0;
 };
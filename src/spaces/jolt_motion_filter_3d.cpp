@@ -9,11 +9,21 @@
 #include "spaces/jolt_broad_phase_layer.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
-JoltMotionFilter3D::JoltMotionFilter3D(const JoltBodyImpl3D& p_body, bool p_collide_separation_ray)
+JoltMotionFilter3D::JoltMotionFilter3D(
+	const JoltBodyImpl3D& p_body,
+	bool p_collide_separation_ray,
+	bool p_check_exclusions
+)
 	: physics_server(*static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton()))
 	, body_self(p_body)
 	, space(*body_self.get_space())
-	, collide_separation_ray(p_collide_separation_ray) { }
+	, collide_separation_ray(p_collide_separation_ray)
+	, check_exclusions(p_check_exclusions) {
+	const JoltReadableBody3D jolt_body_self = space.read_body(body_self);
+	QUIET_FAIL_COND(!jolt_body_self.is_valid());
+
+	collision_group_self = jolt_body_self->GetCollisionGroup();
+}
 
 bool JoltMotionFilter3D::ShouldCollide(JPH::BroadPhaseLayer p_broad_phase_layer) const {
 	const auto broad_phase_layer = (JPH::BroadPhaseLayer::Type)p_broad_phase_layer;
@@ -57,17 +67,13 @@ bool JoltMotionFilter3D::ShouldCollideLocked(const JPH::Body& p_jolt_body) const
 		return false;
 	}
 
-	const auto* object = reinterpret_cast<const JoltObjectImpl3D*>(p_jolt_body.GetUserData());
-
-	if (physics_server.body_test_motion_is_excluding_object(object->get_instance_id()) ||
-		physics_server.body_test_motion_is_excluding_body(object->get_rid()))
-	{
+	if (!collision_group_self.CanCollide(p_jolt_body.GetCollisionGroup())) {
 		return false;
 	}
 
-	const JoltReadableBody3D jolt_body_self = space.read_body(body_self);
+	const auto* object = reinterpret_cast<const JoltObjectImpl3D*>(p_jolt_body.GetUserData());
 
-	return jolt_body_self->GetCollisionGroup().CanCollide(p_jolt_body.GetCollisionGroup());
+	return !check_exclusions || !_is_excluded(*object);
 }
 
 bool JoltMotionFilter3D::ShouldCollide(
@@ -92,3 +98,14 @@ bool JoltMotionFilter3D::ShouldCollide(
 
 	return actual_shape_self.GetSubType() != JoltCustomShapeSubType::RAY;
 }
+
+bool JoltMotionFilter3D::_is_excluded(const JoltObjectImpl3D& p_object) const {
+	// The same objects tend to show up over and over across the recovery iterations, so this ends
+	// up saving a fair amount of calls into the engine.
+	const RID rid = p_object.get_rid();
+
+	return exclusion_cache.is_excluded(rid, [&]() {
+		return physics_server.body_test_motion_is_excluding_object(p_object.get_instance_id()) ||
+			physics_server.body_test_motion_is_excluding_body(rid);
+	});
+}
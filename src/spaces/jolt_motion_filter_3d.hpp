@@ -1,6 +1,9 @@
 #pragma once
 
+#include "spaces/jolt_query_exclusion_cache.hpp"
+
 class JoltBodyImpl3D;
+class JoltObjectImpl3D;
 class JoltPhysicsServer3D;
 class JoltSpace3D;
 
@@ -10,7 +13,11 @@ class JoltMotionFilter3D final
 	, public JPH::BodyFilter
 	, public JPH::ShapeFilter {
 public:
-	explicit JoltMotionFilter3D(const JoltBodyImpl3D& p_body, bool p_collide_separation_ray = true);
+	explicit JoltMotionFilter3D(
+		const JoltBodyImpl3D& p_body,
+		bool p_collide_separation_ray = true,
+		bool p_check_exclusions = true
+	);
 
 	bool ShouldCollide(JPH::BroadPhaseLayer p_broad_phase_layer) const override;
 
@@ -31,6 +38,12 @@ public:
 	) const override;
 
 private:
+	bool _is_excluded(const JoltObjectImpl3D& p_object) const;
+
+	mutable JoltQueryExclusionCache exclusion_cache;
+
+	JPH::CollisionGroup collision_group_self;
+
 	const JoltPhysicsServer3D& physics_server;
 
 	const JoltBodyImpl3D& body_self;
@@ -38,4 +51,6 @@ private:
 	const JoltSpace3D& space;
 
 	bool collide_separation_ray = false;
+
+	bool check_exclusions = true;
 };
@@ -12,6 +12,28 @@
 #include "spaces/jolt_query_filter_3d.hpp"
 #include "spaces/jolt_space_3d.hpp"
 
+namespace {
+
+constexpr int32_t MIN_RAYS_PER_CHUNK = 64;
+
+// How far on either side of the time of impact we verify the safe and unsafe fractions, in meters
+constexpr float TIME_OF_IMPACT_TOLERANCE = 0.0005f;
+
+} // namespace
+
+void JoltPhysicsDirectSpaceState3D::_bind_methods() {
+	BIND_METHOD(
+		JoltPhysicsDirectSpaceState3D,
+		intersect_rays,
+		"from_to",
+		"collision_mask",
+		"collide_with_bodies",
+		"collide_with_areas",
+		"hit_from_inside",
+		"hit_back_faces"
+	);
+}
+
 JoltPhysicsDirectSpaceState3D::JoltPhysicsDirectSpaceState3D(JoltSpace3D* p_space)
 	: space(p_space) { }
 
@@ -26,6 +48,8 @@ bool JoltPhysicsDirectSpaceState3D::_intersect_ray(
 	bool p_pick_ray,
 	PhysicsServer3DExtensionRayResult* p_result
 ) {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
 	const JoltQueryFilter3D query_filter(
 		*this,
 		p_collision_mask,
@@ -100,6 +124,8 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_point(
 	PhysicsServer3DExtensionShapeResult* p_results,
 	int32_t p_max_results
 ) {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
 	if (p_max_results == 0) {
 		return 0;
 	}
@@ -114,12 +140,21 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_point(
 
 	const int32_t hit_count = collector.get_hit_count();
 
+	InlineVector<JPH::BodyID, 32> hit_body_ids(hit_count);
+
+	for (int32_t i = 0; i < hit_count; ++i) {
+		hit_body_ids.push_back(collector.get_hit(i).mBodyID);
+	}
+
+	const JoltScopedBodyReader3D body_reader(*space, hit_body_ids.ptr(), hit_count);
+
 	for (int32_t i = 0; i < hit_count; ++i) {
 		const JPH::CollidePointResult& hit = collector.get_hit(i);
 
-		const JoltReadableBody3D body = space->read_body(hit.mBodyID);
-		const JoltObjectImpl3D* object = body.as_object();
-		ERR_FAIL_NULL_D(object);
+		const JPH::Body* body = body_reader.try_get(i);
+		ERR_FAIL_NULL_D(body);
+
+		const auto* object = reinterpret_cast<const JoltObjectImpl3D*>(body->GetUserData());
 
 		PhysicsServer3DExtensionShapeResult& result = *p_results++;
 
@@ -149,6 +184,8 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_shape(
 	PhysicsServer3DExtensionShapeResult* p_results,
 	int32_t p_max_results
 ) {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
 	if (p_max_results == 0) {
 		return 0;
 	}
@@ -215,12 +252,21 @@ int32_t JoltPhysicsDirectSpaceState3D::_intersect_shape(
 
 	const int32_t hit_count = collector.get_hit_count();
 
+	InlineVector<JPH::BodyID, 32> hit_body_ids(hit_count);
+
+	for (int32_t i = 0; i < hit_count; ++i) {
+		hit_body_ids.push_back(collector.get_hit(i).mBodyID2);
+	}
+
+	const JoltScopedBodyReader3D body_reader(*space, hit_body_ids.ptr(), hit_count);
+
 	for (int32_t i = 0; i < hit_count; ++i) {
 		const JPH::CollideShapeResult& hit = collector.get_hit(i);
 
-		const JoltReadableBody3D body = space->read_body(hit.mBodyID2);
-		const JoltObjectImpl3D* object = body.as_object();
-		ERR_FAIL_NULL_D(object);
+		const JPH::Body* body = body_reader.try_get(i);
+		ERR_FAIL_NULL_D(body);
+
+		const auto* object = reinterpret_cast<const JoltObjectImpl3D*>(body->GetUserData());
 
 		PhysicsServer3DExtensionShapeResult& result = *p_results++;
 
@@ -251,6 +297,8 @@ bool JoltPhysicsDirectSpaceState3D::_cast_motion(
 	real_t* p_closest_unsafe,
 	PhysicsServer3DExtensionShapeRestInfo* p_info
 ) {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
 	// HACK(mihe): This rest info parameter doesn't seem to be used anywhere within Godot, and isn't
 	// exposed in the bindings, so this will be unsupported until anyone actually needs it.
 	ERR_FAIL_COND_D_MSG(
@@ -332,6 +380,8 @@ bool JoltPhysicsDirectSpaceState3D::_collide_shape(
 	int32_t p_max_results,
 	int32_t* p_result_count
 ) {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
 	*p_result_count = 0;
 
 	if (p_max_results == 0) {
@@ -453,6 +503,8 @@ bool JoltPhysicsDirectSpaceState3D::_rest_info(
 	bool p_collide_with_areas,
 	PhysicsServer3DExtensionShapeRestInfo* p_info
 ) {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
 #ifdef DEBUG_ENABLED
 	ERR_FAIL_COND_D_MSG(
 		p_transform.basis.determinant() == 0.0f,
@@ -541,10 +593,167 @@ bool JoltPhysicsDirectSpaceState3D::_rest_info(
 	return true;
 }
 
+Dictionary JoltPhysicsDirectSpaceState3D::intersect_rays(
+	const PackedVector3Array& p_from_to,
+	uint32_t p_collision_mask,
+	bool p_collide_with_bodies,
+	bool p_collide_with_areas,
+	bool p_hit_from_inside,
+	bool p_hit_back_faces
+) {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
+	ERR_FAIL_COND_D_MSG(
+		p_from_to.size() % 2 != 0,
+		"Failed to intersect rays. Expected pairs of from/to positions."
+	);
+
+	const auto ray_count = (int32_t)(p_from_to.size() / 2);
+
+	// Exclusions are queried from the engine, which is not something we can safely do from the job
+	// system, so we disregard any exclusions in this batched version.
+	const JoltQueryFilter3D query_filter(
+		*this,
+		p_collision_mask,
+		p_collide_with_bodies,
+		p_collide_with_areas,
+		false,
+		false
+	);
+
+	JPH::RayCastSettings settings;
+	settings.mTreatConvexAsSolid = p_hit_from_inside;
+	settings.mBackFaceMode = p_hit_back_faces
+		? JPH::EBackFaceMode::CollideWithBackFaces
+		: JPH::EBackFaceMode::IgnoreBackFaces;
+
+	const JPH::NarrowPhaseQuery& narrow_phase_query = space->get_narrow_phase_query();
+
+	const Vector3* from_to = p_from_to.ptr();
+
+	LocalVector<JPH::RayCastResult> hits;
+	hits.resize(ray_count);
+
+	JPH::JobSystem& job_system = space->get_job_system();
+
+	run_in_job_chunks(
+		job_system,
+		"intersect_rays",
+		ray_count,
+		calculate_job_chunk_count(job_system, ray_count, MIN_RAYS_PER_CHUNK),
+		[&]([[maybe_unused]] int32_t p_chunk, int32_t p_start, int32_t p_end) {
+			for (int32_t i = p_start; i < p_end; ++i) {
+				const JPH::RVec3 from = to_jolt_r(from_to[i * 2 + 0]);
+				const JPH::RVec3 to = to_jolt_r(from_to[i * 2 + 1]);
+				const JPH::RRayCast ray(from, JPH::Vec3(to - from));
+
+				JoltQueryCollectorClosest<JPH::CastRayCollector> collector;
+
+				narrow_phase_query
+					.CastRay(ray, settings, collector, query_filter, query_filter, query_filter);
+
+				if (collector.had_hit()) {
+					hits[i] = collector.get_hit();
+				}
+			}
+		}
+	);
+
+	PackedVector3Array positions;
+	positions.resize(ray_count);
+
+	PackedVector3Array normals;
+	normals.resize(ray_count);
+
+	PackedInt64Array collider_ids;
+	collider_ids.resize(ray_count);
+
+	PackedInt64Array colliders;
+	colliders.resize(ray_count);
+
+	PackedInt32Array shapes;
+	shapes.resize(ray_count);
+
+	Vector3* position_ptr = positions.ptrw();
+	Vector3* normal_ptr = normals.ptrw();
+	int64_t* collider_id_ptr = collider_ids.ptrw();
+	int64_t* collider_ptr = colliders.ptrw();
+	int32_t* shape_ptr = shapes.ptrw();
+
+	LocalVector<JPH::BodyID> hit_body_ids;
+	hit_body_ids.resize(ray_count);
+
+	for (int32_t i = 0; i < ray_count; ++i) {
+		hit_body_ids[i] = hits[i].mBodyID;
+	}
+
+	JoltBodyReader3D body_reader(space);
+	body_reader.acquire(hit_body_ids.ptr(), ray_count);
+
+	for (int32_t i = 0; i < ray_count; ++i) {
+		position_ptr[i] = Vector3();
+		normal_ptr[i] = Vector3();
+		collider_id_ptr[i] = 0;
+		collider_ptr[i] = 0;
+		shape_ptr[i] = -1;
+
+		const JPH::Body* body = body_reader.try_get(i);
+
+		if (body == nullptr) {
+			continue;
+		}
+
+		const auto* object = reinterpret_cast<const JoltObjectImpl3D*>(body->GetUserData());
+
+		const JPH::RayCastResult& hit = hits[i];
+
+		const JPH::RVec3 from = to_jolt_r(from_to[i * 2 + 0]);
+		const JPH::RVec3 to = to_jolt_r(from_to[i * 2 + 1]);
+		const auto vector = JPH::Vec3(to - from);
+		const JPH::RRayCast ray(from, vector);
+
+		const JPH::RVec3 position = ray.GetPointOnRay(hit.mFraction);
+
+		JPH::Vec3 normal = JPH::Vec3::sZero();
+
+		if (!p_hit_from_inside || hit.mFraction > 0.0f) {
+			normal = body->GetWorldSpaceSurfaceNormal(hit.mSubShapeID2, position);
+
+			// If we got a back-face normal we need to flip it
+			if (normal.Dot(vector) > 0) {
+				normal = -normal;
+			}
+		}
+
+		position_ptr[i] = to_godot(position);
+		normal_ptr[i] = to_godot(normal);
+		collider_id_ptr[i] = (int64_t)(uint64_t)object->get_instance_id();
+		collider_ptr[i] = (int64_t)object->get_rid().get_id();
+		shape_ptr[i] = 0;
+
+		if (const JoltShapedObjectImpl3D* shaped_object = object->as_shaped()) {
+			shape_ptr[i] = shaped_object->find_shape_index(hit.mSubShapeID2);
+		}
+	}
+
+	body_reader.release();
+
+	Dictionary result;
+	result["position"] = positions;
+	result["normal"] = normals;
+	result["collider_id"] = collider_ids;
+	result["collider"] = colliders;
+	result["shape"] = shapes;
+
+	return result;
+}
+
 Vector3 JoltPhysicsDirectSpaceState3D::_get_closest_point_to_object_volume(
 	const RID& p_object,
 	const Vector3& p_point
 ) const {
+	const JoltPhysicsServer3D::ReadGuard read_guard(*space);
+
 	auto* physics_server = static_cast<JoltPhysicsServer3D*>(PhysicsServer3D::get_singleton());
 
 	JoltObjectImpl3D* object = physics_server->get_area(p_object);
@@ -644,6 +853,7 @@ bool JoltPhysicsDirectSpaceState3D::test_body_motion(
 	int32_t p_max_collisions,
 	bool p_collide_separation_ray,
 	bool p_recovery_as_collision,
+	bool p_check_exclusions,
 	PhysicsServer3DExtensionMotionResult* p_result
 ) const {
 	p_margin = MAX(p_margin, 0.0001f);
@@ -673,7 +883,13 @@ bool JoltPhysicsDirectSpaceState3D::test_body_motion(
 #endif // DEBUG_ENABLED
 
 	Vector3 recovery;
-	const bool recovered = _body_motion_recover(p_body, transform, p_margin, recovery);
+	const bool recovered = _body_motion_recover(
+		p_body,
+		transform,
+		p_margin,
+		p_check_exclusions,
+		recovery
+	);
 
 	transform.origin += recovery;
 
@@ -686,6 +902,7 @@ bool JoltPhysicsDirectSpaceState3D::test_body_motion(
 		scale,
 		p_motion,
 		p_collide_separation_ray,
+		p_check_exclusions,
 		safe_fraction,
 		unsafe_fraction
 	);
@@ -699,6 +916,7 @@ bool JoltPhysicsDirectSpaceState3D::test_body_motion(
 			(float)p_motion.length(),
 			p_margin,
 			p_max_collisions,
+			p_check_exclusions,
 			p_result
 		);
 	}
@@ -760,20 +978,24 @@ bool JoltPhysicsDirectSpaceState3D::_cast_motion_impl(
 	const JPH::Vec3 motion = to_jolt(p_motion);
 	const JPH::Vec3 motion_local = transform_com.Multiply3x3Transposed(motion);
 
-	JPH::AABox aabb = p_jolt_shape.GetWorldSpaceBounds(transform_com, scale);
-	JPH::AABox aabb_translated = aabb;
-	aabb_translated.Translate(motion);
-	aabb.Encapsulate(aabb_translated);
+	// Rather than testing everything within the bounds of the entire motion, we sweep the bounds
+	// of the shape along the motion, which for long diagonal motions results in far fewer
+	// candidates. Sorting them by when the sweep first enters them then lets us stop as soon as the
+	// remaining candidates can't possibly be hit any earlier than what we've already found.
+	const JPH::AABox aabb = p_jolt_shape.GetWorldSpaceBounds(transform_com, scale);
+	const JPH::AABoxCast aabb_cast = {aabb, motion};
 
-	JoltQueryCollectorAnyMulti<JPH::CollideShapeBodyCollector, 2048> aabb_collector;
+	JoltQueryCollectorAnyMulti<JPH::CastShapeBodyCollector, 2048> aabb_collector;
 
 	space->get_broad_phase_query()
-		.CollideAABox(aabb, aabb_collector, p_broad_phase_layer_filter, p_object_layer_filter);
+		.CastAABox(aabb_cast, aabb_collector, p_broad_phase_layer_filter, p_object_layer_filter);
 
 	if (!aabb_collector.had_hit()) {
 		return false;
 	}
 
+	aabb_collector.sort_by_fraction();
+
 	const JPH::RVec3 base_offset = transform_com.GetTranslation();
 
 	JoltCustomMotionShape motion_shape(static_cast<const JPH::ConvexShape&>(p_jolt_shape));
@@ -798,14 +1020,55 @@ bool JoltPhysicsDirectSpaceState3D::_cast_motion_impl(
 		return collide_collector.finish();
 	};
 
+	// Shape-casting gives us the time of impact directly, but it has no notion of a separation
+	// distance, and it can't be filtered the same way for separation rays, so in those cases we
+	// fall back to only doing the binary search below.
+	const bool use_time_of_impact = p_settings.mMaxSeparationDistance == 0.0f &&
+		p_jolt_shape.GetSubType() != JoltCustomShapeSubType::RAY;
+
+	const JPH::RShapeCast shape_cast(&p_jolt_shape, scale, transform_com, motion);
+
+	JPH::ShapeCastSettings cast_settings;
+	cast_settings.mBackFaceModeTriangles = p_settings.mBackFaceMode;
+	cast_settings.mBackFaceModeConvex = p_settings.mBackFaceMode;
+
+	const float toi_tolerance = TIME_OF_IMPACT_TOLERANCE / MAX(motion_length, (float)CMP_EPSILON);
+
+	auto time_of_impact = [&](const JPH::Body& p_other_body, float& p_fraction) {
+		const JPH::TransformedShape other_shape = p_other_body.GetTransformedShape();
+
+		JoltQueryCollectorClosest<JPH::CastShapeCollector> cast_collector;
+
+		other_shape.CastShape(shape_cast, cast_settings, base_offset, cast_collector);
+
+		if (!cast_collector.had_hit()) {
+			return false;
+		}
+
+		p_fraction = cast_collector.get_hit().mFraction;
+
+		return true;
+	};
+
 	// Figure out the number of steps we need in our binary search in order to achieve millimeter
 	// precision, within reason. Derived from `2^-step_count * motion_length = 0.001`.
 	const int32_t step_count = CLAMP(int32_t(logf(1000.0f * motion_length) / Mathf_LN2), 4, 16);
 
+	// Anything within the separation distance counts as a collision, so a candidate that the sweep
+	// enters after our closest collision can't be ruled out until it's beyond that distance
+	const float separation_fraction = p_settings.mMaxSeparationDistance /
+		MAX(motion_length, (float)CMP_EPSILON);
+
 	bool collided = false;
 
 	for (int32_t i = 0; i < aabb_collector.get_hit_count(); ++i) {
-		const JPH::BodyID other_jolt_id = aabb_collector.get_hit(i);
+		const JPH::BroadPhaseCastResult& aabb_hit = aabb_collector.get_hit(i);
+
+		if (aabb_hit.mFraction > p_closest_unsafe + separation_fraction) {
+			break;
+		}
+
+		const JPH::BodyID other_jolt_id = aabb_hit.mBodyID;
 
 		if (!p_body_filter.ShouldCollide(other_jolt_id)) {
 			continue;
@@ -827,6 +1090,27 @@ bool JoltPhysicsDirectSpaceState3D::_cast_motion_impl(
 
 		float lo = 0.0f;
 		float hi = 1.0f;
+
+		float toi = 0.0f;
+
+		if (use_time_of_impact && time_of_impact(*other_jolt_body, toi)) {
+			const float safe = MAX(toi - toi_tolerance, 0.0f);
+			const float unsafe = MIN(toi + toi_tolerance, 1.0f);
+
+			// The shape-cast doesn't account for things like enhanced internal edge removal, so we
+			// make sure that its result agrees with our regular collision test before using it.
+			if (!collides(*other_jolt_body, safe) && collides(*other_jolt_body, unsafe)) {
+				collided = true;
+
+				if (safe < p_closest_safe) {
+					p_closest_safe = safe;
+					p_closest_unsafe = unsafe;
+				}
+
+				continue;
+			}
+		}
+
 		float coeff = 0.5f;
 
 		for (int j = 0; j < step_count; ++j) {
@@ -866,6 +1150,7 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_recover(
 	const JoltBodyImpl3D& p_body,
 	const Transform3D& p_transform,
 	float p_margin,
+	bool p_check_exclusions,
 	Vector3& p_recovery
 ) const {
 	const int32_t recovery_iterations = JoltProjectSettings::get_kinematic_recovery_iterations();
@@ -874,7 +1159,8 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_recover(
 	const JPH::Shape* jolt_shape = p_body.get_jolt_shape();
 
 	const Vector3 com_scaled = to_godot(jolt_shape->GetCenterOfMass());
-	Transform3D transform_com = p_transform.translated_local(com_scaled);
+	const Transform3D initial_transform_com = p_transform.translated_local(com_scaled);
+	Transform3D transform_com = initial_transform_com;
 
 	JPH::CollideShapeSettings settings;
 	settings.mMaxSeparationDistance = p_margin;
@@ -885,12 +1171,112 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_recover(
 
 	const Vector3& base_offset = transform_com.origin;
 
-	const JoltMotionFilter3D motion_filter(p_body);
+	const JoltMotionFilter3D motion_filter(p_body, true, p_check_exclusions);
+
+	// Characters standing still tend to end up redoing the exact same recovery over and over, so
+	// once a body has been tested from the same transform twice in a row we keep track of what the
+	// recovery ran into. As long as the body stays exactly where it is, and nothing that the
+	// recovery could have reached has moved, the result is bound to be the same, which we can
+	// verify with a single broad phase query instead of the full set of iterations. Bodies that
+	// are moving never get that far, so they don't pay for any of this.
+	using Candidate = JoltBodyImpl3D::MotionRecoveryCandidate;
+
+	auto gather_candidates = [&](float p_reach, LocalVector<Candidate>& p_candidates) {
+		JPH::AABox bounds = jolt_shape->GetWorldSpaceBounds(
+			to_jolt_r(initial_transform_com),
+			JPH::Vec3::sReplicate(1.0f)
+		);
+
+		bounds.ExpandBy(JPH::Vec3::sReplicate(p_margin + p_reach));
+
+		JoltQueryCollectorAll<JPH::CollideShapeBodyCollector, 32> bounds_collector;
+
+		space->get_broad_phase_query()
+			.CollideAABox(bounds, bounds_collector, motion_filter, motion_filter);
+
+		InlineVector<JPH::BodyID, 32> other_ids(bounds_collector.get_hit_count());
+
+		for (int32_t i = 0; i < bounds_collector.get_hit_count(); ++i) {
+			const JPH::BodyID& other_id = bounds_collector.get_hit(i);
+
+			if (motion_filter.ShouldCollide(other_id)) {
+				other_ids.push_back(other_id);
+			}
+		}
+
+		p_candidates.clear();
+
+		const JoltScopedBodyReader3D other_reader(*space, other_ids.ptr(), other_ids.size());
+
+		for (int32_t i = 0; i < other_ids.size(); ++i) {
+			const JPH::Body* other_jolt_body = other_reader.try_get(i);
+
+			if (other_jolt_body == nullptr) {
+				continue;
+			}
+
+			if (!motion_filter.ShouldCollideLocked(*other_jolt_body)) {
+				continue;
+			}
+
+			const auto* other_object = reinterpret_cast<const JoltObjectImpl3D*>(
+				other_jolt_body->GetUserData()
+			);
+
+			const JoltBodyImpl3D* other_body = other_object->as_body();
+			ERR_CONTINUE(other_body == nullptr);
+
+			Candidate& candidate = p_candidates.emplace_back();
+			candidate.shape = other_jolt_body->GetShape();
+			candidate.position = other_jolt_body->GetCenterOfMassPosition();
+			candidate.rotation = other_jolt_body->GetRotation();
+			candidate.id = other_ids[i];
+			candidate.priority = other_body->get_collision_priority();
+		}
+
+		p_candidates.sort([](const Candidate& p_lhs, const Candidate& p_rhs) {
+			return p_lhs.id < p_rhs.id;
+		});
+	};
+
+	JoltBodyImpl3D::MotionRecoveryCache& cache = p_body.get_motion_recovery_cache();
+
+	// Batched motion tests can end up testing the same body on several threads at once, in which
+	// case all but one of them simply bypass the cache.
+	const bool use_cache = !cache.in_use.exchange(true, std::memory_order_acquire);
+
+	const bool stationary = use_cache && cache.shape == jolt_shape && cache.margin == p_margin &&
+		cache.transform == p_transform;
+
+	if (stationary && cache.valid) {
+		LocalVector<Candidate> candidates;
+		gather_candidates(cache.reach, candidates);
+
+		const bool unchanged = std::equal(
+			candidates.begin(),
+			candidates.end(),
+			cache.candidates.begin(),
+			cache.candidates.end()
+		);
+
+		if (unchanged) {
+			const bool recovered = cache.recovered;
+			p_recovery += cache.recovery;
+			cache.in_use.store(false, std::memory_order_release);
+			return recovered;
+		}
+	}
 
 	JoltQueryCollectorAnyMultiNoEdges<32> collector;
 
+	InlineVector<const JoltBodyImpl3D*, 32> other_bodies;
+
 	bool recovered = false;
 
+	Vector3 total_recovery;
+
+	float reach = 0.0f;
+
 	for (int32_t i = 0; i < recovery_iterations; ++i) {
 		collector.reset();
 
@@ -913,16 +1299,36 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_recover(
 
 		const int32_t hit_count = collector.get_hit_count();
 
+		other_bodies.clear();
+
 		float combined_priority = 0.0;
 
-		for (int j = 0; j < hit_count; j++) {
-			const JPH::CollideShapeResult& hit = collector.get_hit(j);
+		{
+			InlineVector<JPH::BodyID, 32> other_ids(hit_count);
 
-			const JoltReadableBody3D other_jolt_body = space->read_body(hit.mBodyID2);
-			const JoltBodyImpl3D* other_body = other_jolt_body.as_body();
-			ERR_CONTINUE(other_body == nullptr);
+			for (int32_t j = 0; j < hit_count; ++j) {
+				other_ids.push_back(collector.get_hit(j).mBodyID2);
+			}
+
+			const JoltScopedBodyReader3D other_reader(*space, other_ids.ptr(), hit_count);
+
+			for (int32_t j = 0; j < hit_count; ++j) {
+				const JoltBodyImpl3D* other_body = nullptr;
 
-			combined_priority += other_body->get_collision_priority();
+				if (const JPH::Body* other_jolt_body = other_reader.try_get(j)) {
+					const auto* other_object = reinterpret_cast<const JoltObjectImpl3D*>(
+						other_jolt_body->GetUserData()
+					);
+
+					other_body = other_object->as_body();
+				}
+
+				other_bodies.push_back(other_body);
+
+				ERR_CONTINUE(other_body == nullptr);
+
+				combined_priority += other_body->get_collision_priority();
+			}
 		}
 
 		const float average_priority = MAX(
@@ -952,9 +1358,11 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_recover(
 				continue;
 			}
 
-			const JoltReadableBody3D other_jolt_body = space->read_body(hit.mBodyID2);
-			const JoltBodyImpl3D* other_body = other_jolt_body.as_body();
-			ERR_CONTINUE(other_body == nullptr);
+			const JoltBodyImpl3D* other_body = other_bodies[j];
+
+			if (other_body == nullptr) {
+				continue;
+			}
 
 			const float recovery_distance = penetration_depth * recovery_amount;
 			const float other_priority = other_body->get_collision_priority();
@@ -969,9 +1377,28 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_recover(
 		}
 
 		p_recovery += recovery;
+		total_recovery += recovery;
+		reach += (float)recovery.length();
 		transform_com.origin += recovery;
 	}
 
+	if (use_cache) {
+		if (stationary) {
+			gather_candidates(reach, cache.candidates);
+
+			cache.recovery = total_recovery;
+			cache.reach = reach;
+			cache.recovered = recovered;
+		}
+
+		cache.shape = jolt_shape;
+		cache.transform = p_transform;
+		cache.margin = p_margin;
+		cache.valid = stationary;
+
+		cache.in_use.store(false, std::memory_order_release);
+	}
+
 	return recovered;
 }
 
@@ -981,6 +1408,7 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_cast(
 	const Vector3& p_scale,
 	const Vector3& p_motion,
 	bool p_collide_separation_ray,
+	bool p_check_exclusions,
 	real_t& p_safe_fraction,
 	real_t& p_unsafe_fraction
 ) const {
@@ -992,7 +1420,11 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_cast(
 		settings.mCollectFacesMode = JPH::ECollectFacesMode::CollectFaces;
 	}
 
-	const JoltMotionFilter3D motion_filter(p_body, p_collide_separation_ray);
+	const JoltMotionFilter3D motion_filter(
+		p_body,
+		p_collide_separation_ray,
+		p_check_exclusions
+	);
 
 	bool collided = false;
 
@@ -1055,6 +1487,7 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_collide(
 	float p_distance,
 	float p_margin,
 	int32_t p_max_collisions,
+	bool p_check_exclusions,
 	PhysicsServer3DExtensionMotionResult* p_result
 ) const {
 	const JPH::Shape* jolt_shape = p_body.get_jolt_shape();
@@ -1068,7 +1501,7 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_collide(
 
 	const Vector3& base_offset = transform_com.origin;
 
-	const JoltMotionFilter3D motion_filter(p_body);
+	const JoltMotionFilter3D motion_filter(p_body, true, p_check_exclusions);
 
 	JoltQueryCollectorClosestMultiNoEdges<32> collector(p_max_collisions);
 
@@ -1099,9 +1532,19 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_collide(
 	// to actually emit contacts though, so we clamp it by the distance moved.
 	const float min_contact_depth = MIN(0.0001f, p_distance);
 
+	const int32_t hit_count = collector.get_hit_count();
+
+	InlineVector<JPH::BodyID, 32> collider_ids(hit_count);
+
+	for (int32_t i = 0; i < hit_count; ++i) {
+		collider_ids.push_back(collector.get_hit(i).mBodyID2);
+	}
+
+	const JoltScopedBodyReader3D collider_reader(*space, collider_ids.ptr(), hit_count);
+
 	int32_t count = 0;
 
-	for (int32_t i = 0; i < collector.get_hit_count(); ++i) {
+	for (int32_t i = 0; i < hit_count; ++i) {
 		const JPH::CollideShapeResult& hit = collector.get_hit(i);
 
 		JPH::ContactPoints contact_points1;
@@ -1127,8 +1570,14 @@ bool JoltPhysicsDirectSpaceState3D::_body_motion_collide(
 			continue;
 		}
 
-		const JoltReadableBody3D collider_jolt_body = space->read_body(hit.mBodyID2);
-		const JoltShapedObjectImpl3D* collider = collider_jolt_body.as_shaped();
+		const JPH::Body* collider_jolt_body = collider_reader.try_get(i);
+		ERR_FAIL_NULL_D(collider_jolt_body);
+
+		const auto* collider_object = reinterpret_cast<const JoltObjectImpl3D*>(
+			collider_jolt_body->GetUserData()
+		);
+
+		const JoltShapedObjectImpl3D* collider = collider_object->as_shaped();
 		ERR_FAIL_NULL_D(collider);
 
 		const int32_t local_shape = p_body.find_shape_index(hit.mSubShapeID1);
@@ -8,7 +8,7 @@ class JoltPhysicsDirectSpaceState3D final : public PhysicsDirectSpaceState3DExte
 	GDCLASS_NO_WARN(JoltPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3DExtension)
 
 private:
-	static void _bind_methods() { }
+	static void _bind_methods();
 
 public:
 	JoltPhysicsDirectSpaceState3D() = default;
@@ -85,6 +85,15 @@ public:
 		PhysicsServer3DExtensionShapeRestInfo* p_info
 	) override;
 
+	Dictionary intersect_rays(
+		const PackedVector3Array& p_from_to,
+		uint32_t p_collision_mask,
+		bool p_collide_with_bodies,
+		bool p_collide_with_areas,
+		bool p_hit_from_inside,
+		bool p_hit_back_faces
+	);
+
 	Vector3 _get_closest_point_to_object_volume(const RID& p_object, const Vector3& p_point)
 		const override;
 
@@ -96,6 +105,7 @@ public:
 		int32_t p_max_collisions,
 		bool p_collide_separation_ray,
 		bool p_recovery_as_collision,
+		bool p_check_exclusions,
 		PhysicsServer3DExtensionMotionResult* p_result
 	) const;
 
@@ -121,6 +131,7 @@ private:
 		const JoltBodyImpl3D& p_body,
 		const Transform3D& p_transform,
 		float p_margin,
+		bool p_check_exclusions,
 		Vector3& p_recovery
 	) const;
 
@@ -130,6 +141,7 @@ private:
 		const Vector3& p_scale,
 		const Vector3& p_motion,
 		bool p_collide_separation_ray,
+		bool p_check_exclusions,
 		real_t& p_safe_fraction,
 		real_t& p_unsafe_fraction
 	) const;
@@ -140,6 +152,7 @@ private:
 		float p_distance,
 		float p_margin,
 		int32_t p_max_collisions,
+		bool p_check_exclusions,
 		PhysicsServer3DExtensionMotionResult* p_result
 	) const;
 
@@ -71,6 +71,12 @@ public:
 
 	const Hit& get_hit(int32_t p_index) const { return hits[p_index]; }
 
+	void sort_by_fraction() {
+		hits.sort([](const Hit& p_lhs, const Hit& p_rhs) {
+			return p_lhs.GetEarlyOutFraction() < p_rhs.GetEarlyOutFraction();
+		});
+	}
+
 	void reset() { Reset(); }
 
 	void Reset() override {
@@ -0,0 +1,38 @@
+#pragma once
+
+// The exclusions of a query are only accessible one object at a time, through calls back into the
+// engine, so we remember the answers in case the same object shows up again. Most queries only
+// ever see a handful of objects, so those are kept inline and searched linearly, with a map only
+// being allocated once that runs out.
+class JoltQueryExclusionCache {
+	static constexpr int32_t INLINE_CAPACITY = 8;
+
+public:
+	template<typename TCallback>
+	bool is_excluded(const RID& p_rid, TCallback&& p_callback) {
+		for (const auto& [rid, excluded] : recent) {
+			if (rid == p_rid) {
+				return excluded;
+			}
+		}
+
+		if (const bool* excluded = overflow.getptr(p_rid)) {
+			return *excluded;
+		}
+
+		const bool excluded = p_callback();
+
+		if (recent.size() < INLINE_CAPACITY) {
+			recent.push_back({p_rid, excluded});
+		} else {
+			overflow.insert(p_rid, excluded);
+		}
+
+		return excluded;
+	}
+
+private:
+	InlineVector<std::pair<RID, bool>, INLINE_CAPACITY> recent;
+
+	HashMap<RID, bool> overflow;
+};
@@ -10,14 +10,16 @@ JoltQueryFilter3D::JoltQueryFilter3D(
 	uint32_t p_collision_mask,
 	bool p_collide_with_bodies,
 	bool p_collide_with_areas,
-	bool p_picking
+	bool p_picking,
+	bool p_check_exclusions
 )
 	: space_state(p_space_state)
 	, space(space_state.get_space())
 	, collision_mask(p_collision_mask)
 	, collide_with_bodies(p_collide_with_bodies)
 	, collide_with_areas(p_collide_with_areas)
-	, picking(p_picking) { }
+	, picking(p_picking)
+	, check_exclusions(p_check_exclusions) { }
 
 bool JoltQueryFilter3D::ShouldCollide(JPH::BroadPhaseLayer p_broad_phase_layer) const {
 	const auto broad_phase_layer = (JPH::BroadPhaseLayer::Type)p_broad_phase_layer;
@@ -59,6 +61,15 @@ bool JoltQueryFilter3D::ShouldCollide([[maybe_unused]] const JPH::BodyID& p_body
 bool JoltQueryFilter3D::ShouldCollideLocked(const JPH::Body& p_body) const {
 	auto* object = reinterpret_cast<JoltObjectImpl3D*>(p_body.GetUserData());
 
-	return (!picking || object->is_pickable()) &&
-		!space_state.is_body_excluded_from_query(object->get_rid());
+	if (picking && !object->is_pickable()) {
+		return false;
+	}
+
+	return !check_exclusions || !_is_excluded(object->get_rid());
+}
+
+bool JoltQueryFilter3D::_is_excluded(const RID& p_rid) const {
+	return exclusion_cache.is_excluded(p_rid, [&]() {
+		return space_state.is_body_excluded_from_query(p_rid);
+	});
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "spaces/jolt_query_exclusion_cache.hpp"
+
 class JoltPhysicsDirectSpaceState3D;
 class JoltSpace3D;
 
@@ -13,7 +15,8 @@ public:
 		uint32_t p_collision_mask,
 		bool p_collide_with_bodies,
 		bool p_collide_with_areas,
-		bool p_picking = false
+		bool p_picking = false,
+		bool p_check_exclusions = true
 	);
 
 	bool ShouldCollide(JPH::BroadPhaseLayer p_broad_phase_layer) const override;
@@ -25,6 +28,10 @@ public:
 	bool ShouldCollideLocked(const JPH::Body& p_body) const override;
 
 private:
+	bool _is_excluded(const RID& p_rid) const;
+
+	mutable JoltQueryExclusionCache exclusion_cache;
+
 	const JoltPhysicsDirectSpaceState3D& space_state;
 
 	const JoltSpace3D& space;
@@ -36,4 +43,6 @@ private:
 	bool collide_with_areas = false;
 
 	bool picking = false;
+
+	bool check_exclusions = true;
 };
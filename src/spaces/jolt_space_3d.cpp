@@ -21,6 +21,22 @@ constexpr double DEFAULT_SLEEP_THRESHOLD_LINEAR = 0.1;
 constexpr double DEFAULT_SLEEP_THRESHOLD_ANGULAR = 8.0 * Math_PI / 180;
 constexpr double DEFAULT_SOLVER_ITERATIONS = 8;
 
+constexpr int32_t MIN_BODIES_PER_CHUNK = 128;
+
+// Transform (12), linear velocity (3) and angular velocity (3)
+constexpr int32_t BODY_STATE_STRIDE = 18;
+
+void take_unique_ids(LocalVector<JPH::BodyID>& p_from, LocalVector<JPH::BodyID>& p_to) {
+	for (const JPH::BodyID& body_id : p_from) {
+		p_to.push_back(body_id);
+	}
+
+	p_from.clear();
+
+	p_to.sort();
+	p_to.resize((int32_t)(std::unique(p_to.begin(), p_to.end()) - p_to.begin()));
+}
+
 } // namespace
 
 JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
@@ -75,18 +91,6 @@ JoltSpace3D::JoltSpace3D(JPH::JobSystem* p_job_system)
 			return CLAMP(p_body1.GetRestitution() + p_body2.GetRestitution(), 0.0f, 1.0f);
 		}
 	);
-
-#ifdef GDJ_CONFIG_EDITOR
-	// HACK(mihe): The `EditorLog` class gets initialized fairly late in the application flow, so if
-	// we do this any earlier the warning is only ever going to be emitted to stdout and not the
-	// editor log, hence why this is here.
-	if (JoltProjectSettings::should_run_on_separate_thread()) {
-		WARN_PRINT_ONCE(
-			"Running on a separate thread is not currently supported by Godot Jolt. "
-			"Any such setting will be ignored."
-		);
-	}
-#endif // GDJ_CONFIG_EDITOR
 }
 
 JoltSpace3D::~JoltSpace3D() {
@@ -100,6 +104,14 @@ JoltSpace3D::~JoltSpace3D() {
 void JoltSpace3D::step(float p_step) {
 	last_step = p_step;
 
+	flush_pending_bodies();
+
+	const int32_t rebuild_threshold = JoltProjectSettings::get_broad_phase_rebuild_threshold();
+
+	if (rebuild_threshold > 0 && broad_phase_changes >= rebuild_threshold) {
+		optimize_broad_phase();
+	}
+
 	_pre_step(p_step);
 
 	const JPH::EPhysicsUpdateError
@@ -138,6 +150,8 @@ void JoltSpace3D::step(float p_step) {
 		));
 	}
 
+	temp_allocator->post_step();
+
 	_post_step(p_step);
 
 	has_stepped = true;
@@ -153,7 +167,14 @@ void JoltSpace3D::call_queries() {
 		return;
 	}
 
-	body_accessor.acquire_all();
+	// Bodies pending removal may belong to objects that have since been freed, so we can't let
+	// them be visited below
+	flush_pending_bodies();
+
+	visited_bodies.clear();
+	take_unique_ids(bodies_to_call_queries, visited_bodies);
+
+	body_accessor.acquire(visited_bodies.ptr(), visited_bodies.size());
 
 	const int32_t body_count = body_accessor.get_count();
 
@@ -271,6 +292,146 @@ void JoltSpace3D::set_param(
 	}
 }
 
+void JoltSpace3D::add_body(const JPH::BodyID& p_body_id) {
+	bodies_to_add_indices.insert(p_body_id, bodies_to_add.size());
+	bodies_to_add.push_back(p_body_id);
+
+	// Static bodies never become active, so we make sure that every body gets visited at least once
+	enqueue_pre_step(p_body_id);
+}
+
+void JoltSpace3D::remove_body(const JPH::BodyID& p_body_id) {
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	if (body_iface.IsAdded(p_body_id)) {
+		bodies_to_remove.push_back(p_body_id);
+		return;
+	}
+
+	if (const int32_t* pending_index = bodies_to_add_indices.getptr(p_body_id)) {
+		const int32_t index = *pending_index;
+
+		// Removing a pending body moves the last pending body into its place, so we need to keep
+		// track of that body's new index
+		bodies_to_add.remove_at_unordered(index);
+		bodies_to_add_indices.erase(p_body_id);
+
+		if (index < bodies_to_add.size()) {
+			bodies_to_add_indices[bodies_to_add[index]] = index;
+		}
+	}
+
+	bodies_to_add_asleep.erase(p_body_id);
+
+	release_object_layer(body_iface.GetObjectLayer(p_body_id));
+
+	body_iface.DestroyBody(p_body_id);
+}
+
+void JoltSpace3D::flush_pending_bodies() {
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	if (!bodies_to_remove.is_empty()) {
+		body_iface.RemoveBodies(bodies_to_remove.ptr(), bodies_to_remove.size());
+
+		for (const JPH::BodyID& body_id : bodies_to_remove) {
+			release_object_layer(body_iface.GetObjectLayer(body_id));
+		}
+
+		body_iface.DestroyBodies(bodies_to_remove.ptr(), bodies_to_remove.size());
+
+		broad_phase_changes += bodies_to_remove.size();
+
+		bodies_to_remove.clear();
+	}
+
+	if (!bodies_to_add.is_empty()) {
+		const JPH::BodyInterface::AddState add_state = body_iface.AddBodiesPrepare(
+			bodies_to_add.ptr(),
+			bodies_to_add.size()
+		);
+
+		// HACK(mihe): Since `BODY_STATE_TRANSFORM` will be set right after creation it's more or
+		// less impossible to have a body be sleeping when created, so we default to always starting
+		// out as awake/active.
+		body_iface.AddBodiesFinalize(
+			bodies_to_add.ptr(),
+			bodies_to_add.size(),
+			add_state,
+			JPH::EActivation::Activate
+		);
+
+		// Any bodies that were explicitly put to sleep while pending get deactivated separately,
+		// since activation can only be specified for the batch as a whole
+		if (!bodies_to_add_asleep.is_empty()) {
+			LocalVector<JPH::BodyID> bodies_to_deactivate;
+			bodies_to_deactivate.reserve(bodies_to_add_asleep.size());
+
+			for (const JPH::BodyID& body_id : bodies_to_add_asleep) {
+				bodies_to_deactivate.push_back(body_id);
+			}
+
+			body_iface.DeactivateBodies(bodies_to_deactivate.ptr(), bodies_to_deactivate.size());
+
+			bodies_to_add_asleep.clear();
+		}
+
+		broad_phase_changes += bodies_to_add.size();
+
+		bodies_to_add.clear();
+		bodies_to_add_indices.clear();
+	}
+}
+
+bool JoltSpace3D::is_body_sleeping(const JPH::BodyID& p_body_id) const {
+	const JPH::BodyInterface& body_iface = get_body_iface();
+
+	if (body_iface.IsAdded(p_body_id)) {
+		return !body_iface.IsActive(p_body_id);
+	}
+
+	return bodies_to_add_asleep.has(p_body_id);
+}
+
+void JoltSpace3D::set_body_sleeping(const JPH::BodyID& p_body_id, bool p_enabled) {
+	JPH::BodyInterface& body_iface = get_body_iface();
+
+	if (body_iface.IsAdded(p_body_id)) {
+		if (p_enabled) {
+			body_iface.DeactivateBody(p_body_id);
+		} else {
+			body_iface.ActivateBody(p_body_id);
+		}
+
+		return;
+	}
+
+	// Jolt can only (de)activate bodies that have actually been added to the broad phase, so for
+	// bodies that are still pending we hold on to this until they're added in a batch
+	if (p_enabled) {
+		bodies_to_add_asleep.insert(p_body_id);
+	} else {
+		bodies_to_add_asleep.erase(p_body_id);
+	}
+}
+
+bool JoltSpace3D::is_ready_for_queries() const {
+	return bodies_to_add.is_empty() && bodies_to_remove.is_empty() && direct_state != nullptr;
+}
+
+void JoltSpace3D::prepare_for_queries() {
+	flush_pending_bodies();
+	get_direct_state();
+}
+
+void JoltSpace3D::optimize_broad_phase() {
+	flush_pending_bodies();
+
+	physics_system->OptimizeBroadPhase();
+
+	broad_phase_changes = 0;
+}
+
 JPH::BodyInterface& JoltSpace3D::get_body_iface() {
 	return physics_system->GetBodyInterfaceNoLock();
 }
@@ -283,11 +444,15 @@ const JPH::BodyLockInterface& JoltSpace3D::get_lock_iface() const {
 	return physics_system->GetBodyLockInterfaceNoLock();
 }
 
-const JPH::BroadPhaseQuery& JoltSpace3D::get_broad_phase_query() const {
+const JPH::BroadPhaseQuery& JoltSpace3D::get_broad_phase_query() {
+	flush_pending_bodies();
+
 	return physics_system->GetBroadPhaseQuery();
 }
 
-const JPH::NarrowPhaseQuery& JoltSpace3D::get_narrow_phase_query() const {
+const JPH::NarrowPhaseQuery& JoltSpace3D::get_narrow_phase_query() {
+	flush_pending_bodies();
+
 	return physics_system->GetNarrowPhaseQueryNoLock();
 }
 
@@ -299,6 +464,10 @@ JPH::ObjectLayer JoltSpace3D::map_to_object_layer(
 	return layer_mapper->to_object_layer(p_broad_phase_layer, p_collision_layer, p_collision_mask);
 }
 
+void JoltSpace3D::release_object_layer(JPH::ObjectLayer p_object_layer) {
+	layer_mapper->release_object_layer(p_object_layer);
+}
+
 void JoltSpace3D::map_from_object_layer(
 	JPH::ObjectLayer p_object_layer,
 	JPH::BroadPhaseLayer& p_broad_phase_layer,
@@ -339,6 +508,88 @@ JoltWritableBodies3D JoltSpace3D::write_bodies(const JPH::BodyID* p_body_ids, in
 	return {*this, p_body_ids, p_body_count};
 }
 
+uint64_t JoltSpace3D::get_temp_memory_high_water_mark() const {
+	return temp_allocator->get_high_water_mark();
+}
+
+Dictionary JoltSpace3D::get_active_body_states() {
+	// Each body is written as a record of `BODY_STATE_STRIDE` floats, starting with its scaled
+	// transform laid out the same way as a `MultiMesh` buffer (basis rows interleaved with the
+	// origin) followed by its linear and angular velocity. The ID of each body's RID is written to
+	// a separate array, at the same index as its record.
+	const JPH::BodyID* active_bodies = physics_system->GetActiveBodiesUnsafe(
+		JPH::EBodyType::RigidBody
+	);
+
+	const auto active_body_count = (int32_t)physics_system->GetNumActiveBodies(
+		JPH::EBodyType::RigidBody
+	);
+
+	PackedInt64Array rids;
+	rids.resize(active_body_count);
+
+	PackedFloat32Array states;
+	states.resize((int64_t)active_body_count * BODY_STATE_STRIDE);
+
+	int64_t* rid = rids.ptrw();
+	float* state = states.ptrw();
+	int32_t state_count = 0;
+
+	// This can be called from within the callbacks in `call_queries`, which are themselves
+	// iterating over `body_accessor`, so we need an accessor of our own here
+	const JoltScopedBodyReader3D body_reader(*this, active_bodies, active_body_count);
+
+	for (int32_t i = 0; i < active_body_count; ++i) {
+		const JPH::Body* jolt_body = body_reader.try_get(i);
+
+		if (jolt_body == nullptr || jolt_body->IsSensor()) {
+			continue;
+		}
+
+		const auto* body = reinterpret_cast<const JoltBodyImpl3D*>(jolt_body->GetUserData());
+
+		*rid++ = (int64_t)body->get_rid().get_id();
+
+		const Transform3D transform = Transform3D(
+			to_godot(jolt_body->GetRotation()),
+			to_godot(jolt_body->GetPosition())
+		).scaled_local(body->get_scale());
+
+		for (int32_t row = 0; row < 3; ++row) {
+			state[row * 4 + 0] = (float)transform.basis[row][0];
+			state[row * 4 + 1] = (float)transform.basis[row][1];
+			state[row * 4 + 2] = (float)transform.basis[row][2];
+			state[row * 4 + 3] = (float)transform.origin[row];
+		}
+
+		const JPH::Vec3 linear_velocity = jolt_body->GetLinearVelocity();
+		const JPH::Vec3 angular_velocity = jolt_body->GetAngularVelocity();
+
+		state[12] = linear_velocity.GetX();
+		state[13] = linear_velocity.GetY();
+		state[14] = linear_velocity.GetZ();
+		state[15] = angular_velocity.GetX();
+		state[16] = angular_velocity.GetY();
+		state[17] = angular_velocity.GetZ();
+
+		state += BODY_STATE_STRIDE;
+		state_count += 1;
+	}
+
+	rids.resize(state_count);
+	states.resize((int64_t)state_count * BODY_STATE_STRIDE);
+
+	Dictionary result;
+	result["rids"] = rids;
+	result["states"] = states;
+
+	return result;
+}
+
+const JoltContactBuffer3D& JoltSpace3D::get_reported_contacts() const {
+	return contact_listener->get_reported_contacts();
+}
+
 JoltPhysicsDirectSpaceState3D* JoltSpace3D::get_direct_state() {
 	if (direct_state == nullptr) {
 		direct_state = memnew(JoltPhysicsDirectSpaceState3D(this));
@@ -450,50 +701,137 @@ void JoltSpace3D::set_max_debug_contacts(int32_t p_count) {
 
 #endif // GDJ_CONFIG_EDITOR
 
-void JoltSpace3D::_pre_step(float p_step) {
-	body_accessor.acquire_all();
+void JoltSpace3D::enqueue_pre_step(const JPH::BodyID& p_body_id) {
+	bodies_to_pre_step.push_back(p_body_id);
+}
+
+void JoltSpace3D::enqueue_post_step(const JPH::BodyID& p_body_id) {
+	bodies_to_post_step.push_back(p_body_id);
+}
 
+void JoltSpace3D::enqueue_call_queries(const JPH::BodyID& p_body_id) {
+	bodies_to_call_queries.push_back(p_body_id);
+}
+
+void JoltSpace3D::enqueue_shape_changed(const JPH::BodyID& p_body_id) {
+	bodies_with_changed_shapes.push_back(p_body_id);
+}
+
+void JoltSpace3D::_pre_step(float p_step) {
 	contact_listener->pre_step();
 
+	// Sleeping and static bodies have nothing to do here, unless they were explicitly enqueued, so
+	// we only need to visit those along with the currently active bodies.
+	visited_bodies.clear();
+
+	const JPH::BodyID* active_bodies = physics_system->GetActiveBodiesUnsafe(
+		JPH::EBodyType::RigidBody
+	);
+
+	const auto active_body_count = (int32_t)physics_system->GetNumActiveBodies(
+		JPH::EBodyType::RigidBody
+	);
+
+	for (int32_t i = 0; i < active_body_count; ++i) {
+		visited_bodies.push_back(active_bodies[i]);
+	}
+
+	take_unique_ids(bodies_to_pre_step, visited_bodies);
+
+	body_accessor.acquire(visited_bodies.ptr(), visited_bodies.size());
+
 	const int32_t body_count = body_accessor.get_count();
+	const int32_t chunk_count = calculate_job_chunk_count(
+		*job_system,
+		body_count,
+		MIN_BODIES_PER_CHUNK
+	);
 
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSoftBody()) {
-				continue;
-			}
+	bodies_reporting_contacts.resize(chunk_count);
+
+	// Bodies don't affect each other during this phase, so we can process them concurrently, as
+	// long as anything that needs to be shared with the space is gathered per chunk and then
+	// merged once all the chunks are done.
+	run_in_job_chunks(
+		*job_system,
+		"pre_step",
+		body_count,
+		chunk_count,
+		[&](int32_t p_chunk, int32_t p_start, int32_t p_end) {
+			LocalVector<JPH::BodyID>& reporting_contacts = bodies_reporting_contacts[p_chunk];
+
+			for (int32_t i = p_start; i < p_end; ++i) {
+				JPH::Body* jolt_body = body_accessor.try_get(i);
 
-			auto* object = reinterpret_cast<JoltShapedObjectImpl3D*>(jolt_body->GetUserData());
+				if (jolt_body == nullptr || jolt_body->IsSoftBody()) {
+					continue;
+				}
 
-			object->pre_step(p_step, *jolt_body);
+				auto* object = reinterpret_cast<JoltShapedObjectImpl3D*>(jolt_body->GetUserData());
 
-			if (object->reports_contacts()) {
-				contact_listener->listen_for(object);
+				object->pre_step(p_step, *jolt_body);
+
+				if (object->reports_contacts()) {
+					reporting_contacts.push_back(jolt_body->GetID());
+				}
 			}
 		}
-	}
+	);
 
 	body_accessor.release();
+
+	for (LocalVector<JPH::BodyID>& reporting_contacts : bodies_reporting_contacts) {
+		for (const JPH::BodyID& body_id : reporting_contacts) {
+			contact_listener->listen_for(body_id);
+
+			// Bodies that report contacts need to be visited on every step, regardless of whether
+			// they're active or not, so we keep them enqueued.
+			enqueue_pre_step(body_id);
+		}
+
+		reporting_contacts.clear();
+	}
+
+	// Any of the bodies visited here might have had their state changed, which needs to be
+	// synchronized with their nodes after the step, so we enqueue all of them rather than have
+	// each chunk contend over the same list.
+	for (const JPH::BodyID& body_id : visited_bodies) {
+		enqueue_call_queries(body_id);
+	}
 }
 
 void JoltSpace3D::_post_step(float p_step) {
-	body_accessor.acquire_all();
+	visited_bodies.clear();
+	take_unique_ids(bodies_with_changed_shapes, visited_bodies);
 
-	contact_listener->post_step();
+	contact_listener->post_step(visited_bodies);
+
+	visited_bodies.clear();
+	take_unique_ids(bodies_to_post_step, visited_bodies);
+
+	body_accessor.acquire(visited_bodies.ptr(), visited_bodies.size());
 
 	const int32_t body_count = body_accessor.get_count();
 
-	for (int32_t i = 0; i < body_count; ++i) {
-		if (JPH::Body* jolt_body = body_accessor.try_get(i)) {
-			if (jolt_body->IsSoftBody()) {
-				continue;
-			}
+	run_in_job_chunks(
+		*job_system,
+		"post_step",
+		body_count,
+		calculate_job_chunk_count(*job_system, body_count, MIN_BODIES_PER_CHUNK),
+		[&]([[maybe_unused]] int32_t p_chunk, int32_t p_start, int32_t p_end) {
+			for (int32_t i = p_start; i < p_end; ++i) {
+				JPH::Body* jolt_body = body_accessor.try_get(i);
 
-			auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
+				if (jolt_body == nullptr || jolt_body->IsSoftBody()) {
+					continue;
+				}
 
-			object->post_step(p_step, *jolt_body);
+				auto* object = reinterpret_cast<JoltObjectImpl3D*>(jolt_body->GetUserData());
+
+				object->post_step(p_step, *jolt_body);
+			}
 		}
-	}
+	);
 
 	body_accessor.release();
 }
@@ -3,13 +3,21 @@
 #include "spaces/jolt_body_accessor_3d.hpp"
 
 class JoltAreaImpl3D;
+class JoltContactBuffer3D;
 class JoltContactListener3D;
 class JoltJointImpl3D;
 class JoltLayerMapper;
 class JoltObjectImpl3D;
 class JoltPhysicsDirectSpaceState3D;
+class JoltTempAllocator;
 
 class JoltSpace3D final {
+	struct BodyIDHasher {
+		static uint32_t hash(const JPH::BodyID& p_id) {
+			return hash_fmix32(p_id.GetIndexAndSequenceNumber());
+		}
+	};
+
 public:
 	explicit JoltSpace3D(JPH::JobSystem* p_job_system);
 
@@ -29,15 +37,41 @@ public:
 
 	JPH::PhysicsSystem& get_physics_system() const { return *physics_system; }
 
+	JPH::JobSystem& get_job_system() const { return *job_system; }
+
+	void add_body(const JPH::BodyID& p_body_id);
+
+	void remove_body(const JPH::BodyID& p_body_id);
+
+	void flush_pending_bodies();
+
+	bool is_body_sleeping(const JPH::BodyID& p_body_id) const;
+
+	void set_body_sleeping(const JPH::BodyID& p_body_id, bool p_enabled);
+
+	bool is_ready_for_queries() const;
+
+	void prepare_for_queries();
+
+	void optimize_broad_phase();
+
+	void enqueue_pre_step(const JPH::BodyID& p_body_id);
+
+	void enqueue_post_step(const JPH::BodyID& p_body_id);
+
+	void enqueue_call_queries(const JPH::BodyID& p_body_id);
+
+	void enqueue_shape_changed(const JPH::BodyID& p_body_id);
+
 	JPH::BodyInterface& get_body_iface();
 
 	const JPH::BodyInterface& get_body_iface() const;
 
 	const JPH::BodyLockInterface& get_lock_iface() const;
 
-	const JPH::BroadPhaseQuery& get_broad_phase_query() const;
+	const JPH::BroadPhaseQuery& get_broad_phase_query();
 
-	const JPH::NarrowPhaseQuery& get_narrow_phase_query() const;
+	const JPH::NarrowPhaseQuery& get_narrow_phase_query();
 
 	JPH::ObjectLayer map_to_object_layer(
 		JPH::BroadPhaseLayer p_broad_phase_layer,
@@ -45,6 +79,8 @@ public:
 		uint32_t p_collision_mask
 	);
 
+	void release_object_layer(JPH::ObjectLayer p_object_layer);
+
 	void map_from_object_layer(
 		JPH::ObjectLayer p_object_layer,
 		JPH::BroadPhaseLayer& p_broad_phase_layer,
@@ -66,6 +102,12 @@ public:
 
 	JoltPhysicsDirectSpaceState3D* get_direct_state();
 
+	uint64_t get_temp_memory_high_water_mark() const;
+
+	Dictionary get_active_body_states();
+
+	const JoltContactBuffer3D& get_reported_contacts() const;
+
 	JoltAreaImpl3D* get_default_area() const { return default_area; }
 
 	void set_default_area(JoltAreaImpl3D* p_area);
@@ -99,11 +141,31 @@ private:
 
 	JoltBodyWriter3D body_accessor;
 
+	LocalVector<JPH::BodyID> bodies_to_add;
+
+	HashMap<JPH::BodyID, int32_t, BodyIDHasher> bodies_to_add_indices;
+
+	HashSet<JPH::BodyID, BodyIDHasher> bodies_to_add_asleep;
+
+	LocalVector<JPH::BodyID> bodies_to_remove;
+
+	LocalVector<JPH::BodyID> bodies_to_pre_step;
+
+	LocalVector<JPH::BodyID> bodies_to_post_step;
+
+	LocalVector<JPH::BodyID> bodies_to_call_queries;
+
+	LocalVector<JPH::BodyID> bodies_with_changed_shapes;
+
+	LocalVector<JPH::BodyID> visited_bodies;
+
+	LocalVector<LocalVector<JPH::BodyID>> bodies_reporting_contacts;
+
 	RID rid;
 
 	JPH::JobSystem* job_system = nullptr;
 
-	JPH::TempAllocator* temp_allocator = nullptr;
+	JoltTempAllocator* temp_allocator = nullptr;
 
 	JoltLayerMapper* layer_mapper = nullptr;
 
@@ -117,5 +179,7 @@ private:
 
 	float last_step = 0.0f;
 
+	int32_t broad_phase_changes = 0;
+
 	bool has_stepped = false;
 };
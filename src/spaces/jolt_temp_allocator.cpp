@@ -2,12 +2,12 @@
 
 #include "servers/jolt_project_settings.hpp"
 
-JoltTempAllocator::JoltTempAllocator()
-	: capacity((uint64_t)JoltProjectSettings::get_max_temp_memory_b())
-	, base(static_cast<uint8_t*>(JPH::Allocate((size_t)capacity))) { }
+JoltTempAllocator::JoltTempAllocator() {
+	_add_block((uint64_t)JoltProjectSettings::get_max_temp_memory_b());
+}
 
 JoltTempAllocator::~JoltTempAllocator() {
-	JPH::Free(base);
+	_free_blocks(0);
 }
 
 void* JoltTempAllocator::Allocate(uint32_t p_size) {
@@ -17,24 +17,40 @@ void* JoltTempAllocator::Allocate(uint32_t p_size) {
 
 	p_size = align_up(p_size, 16U);
 
-	const uint64_t new_top = top + p_size;
+	Block* block = &blocks[block_index];
+
+	if (block->top + p_size > block->capacity) {
+		// Any blocks past the current one are guaranteed to be empty, so we can discard them if they
+		// happen to be too small for this allocation
+		const int32_t next_index = block_index + 1;
 
-	void* ptr = nullptr;
+		if (next_index < blocks.size() && blocks[next_index].capacity < p_size) {
+			_free_blocks(next_index);
+		}
 
-	if (new_top <= capacity) {
-		ptr = base + top;
-	} else {
-		WARN_PRINT_ONCE(vformat(
-			"Godot Jolt's temporary memory allocator exceeded capacity of %d MiB. "
-			"Falling back to slower general-purpose allocator. "
-			"Consider increasing maximum temporary memory in project settings.",
-			JoltProjectSettings::get_max_temp_memory_mib()
-		));
+		if (next_index == blocks.size()) {
+			WARN_PRINT_ONCE(vformat(
+				"Godot Jolt's temporary memory allocator exceeded capacity of %d MiB. "
+				"Allocating additional memory, which will be released again once no longer needed. "
+				"Consider increasing maximum temporary memory in project settings.",
+				JoltProjectSettings::get_max_temp_memory_mib()
+			));
 
-		ptr = JPH::Allocate(p_size);
+			_add_block(MAX((uint64_t)p_size, blocks[0].capacity));
+		}
+
+		block_index = next_index;
+		block = &blocks[block_index];
+
+		overflowed = true;
 	}
 
-	top = new_top;
+	void* ptr = block->base + block->top;
+
+	block->top += p_size;
+
+	used += p_size;
+	high_water_mark = MAX(high_water_mark, used);
 
 	return ptr;
 }
@@ -46,15 +62,50 @@ void JoltTempAllocator::Free(void* p_ptr, uint32_t p_size) {
 
 	p_size = align_up(p_size, 16U);
 
-	const uint64_t new_top = top - p_size;
+	Block& block = blocks[block_index];
 
-	if (top <= capacity) {
-		if (base + new_top != p_ptr) {
-			CRASH_NOW_MSG("Temporary memory was freed in the wrong order.");
-		}
-	} else {
-		JPH::Free(p_ptr);
+	const uint64_t new_top = block.top - p_size;
+
+	if (block.base + new_top != p_ptr) {
+		CRASH_NOW_MSG("Temporary memory was freed in the wrong order.");
+	}
+
+	block.top = new_top;
+
+	used -= p_size;
+
+	if (block.top == 0 && block_index > 0) {
+		block_index--;
+	}
+}
+
+void JoltTempAllocator::post_step() {
+	if (overflowed) {
+		overflowed = false;
+		quiet_steps = 0;
+		return;
+	}
+
+	if (blocks.size() == 1) {
+		return;
+	}
+
+	if (++quiet_steps >= JoltProjectSettings::get_temp_memory_shrink_delay()) {
+		_free_blocks(1);
+		quiet_steps = 0;
+	}
+}
+
+void JoltTempAllocator::_add_block(uint64_t p_capacity) {
+	Block& block = blocks.emplace_back();
+	block.base = static_cast<uint8_t*>(JPH::Allocate((size_t)p_capacity));
+	block.capacity = p_capacity;
+}
+
+void JoltTempAllocator::_free_blocks(int32_t p_from_index) {
+	for (int32_t i = p_from_index; i < blocks.size(); ++i) {
+		JPH::Free(blocks[i].base);
 	}
 
-	top = new_top;
+	blocks.resize(p_from_index);
 }
@@ -1,6 +1,14 @@
 #pragma once
 
 class JoltTempAllocator final : public JPH::TempAllocator {
+	struct Block {
+		uint8_t* base = nullptr;
+
+		uint64_t capacity = 0;
+
+		uint64_t top = 0;
+	};
+
 public:
 	explicit JoltTempAllocator();
 
@@ -10,10 +18,24 @@ public:
 
 	void Free(void* p_ptr, uint32_t p_size) override;
 
+	void post_step();
+
+	uint64_t get_high_water_mark() const { return high_water_mark; }
+
 private:
-	uint64_t capacity = 0;
+	void _add_block(uint64_t p_capacity);
+
+	void _free_blocks(int32_t p_from_index);
+
+	LocalVector<Block> blocks;
+
+	uint64_t used = 0;
+
+	uint64_t high_water_mark = 0;
+
+	int32_t block_index = 0;
 
-	uint64_t top = 0;
+	int32_t quiet_steps = 0;
 
-	uint8_t* base = nullptr;
+	bool overflowed = false;
 };